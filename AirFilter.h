@@ -0,0 +1,42 @@
+#pragma once
+// Airspeed front end: ΔP low-pass + hysteresis gate, per sample.
+// Two cascaded 1st-order sections with the same time constant τ (a critically
+// damped 2nd-order low-pass), stepped with the real sample interval so the
+// response doesn't change with the sample rate (adaptive rate, OSR):
+//
+//   group delay (DC) = 2τ      step 10→90 % ≈ 3.4τ      −3 dB at ≈ 0.64/(2πτ)
+//
+// The gate opens when |ΔP| (filtered) reaches `on` and closes below `off`; no
+// hold time, the filter is what rejects single-sample spikes. τ = 0 passes the
+// input through. No Arduino dependencies.
+#include <math.h>
+#include <stdint.h>
+
+class AirFilter {
+public:
+  void  setTauMs(uint32_t ms) { tau_ = ms * 1e-3f; }
+  float tauMs() const { return tau_ * 1e3f; }
+  void  reset() { init_ = false; shown_ = false; }
+
+  // New sample x taken dt_s after the previous one → filtered value
+  float step(float x, float dt_s) {
+    if (!init_ || !(dt_s > 0) || dt_s > 1.0f) { y1_ = y2_ = x; init_ = true; return x; }
+    if (tau_ <= 0) { y1_ = y2_ = x; return x; }
+    const float a = 1.0f - expf(-dt_s / tau_);
+    y1_ += (x   - y1_) * a;
+    y2_ += (y1_ - y2_) * a;
+    return y2_;
+  }
+
+  // Hysteresis on |y|; true while speed should be shown
+  bool gate(float y, float on, float off) {
+    const float m = fabsf(y);
+    if (!shown_ && m >= on)  shown_ = true;
+    else if (shown_ && m < off) shown_ = false;
+    return shown_;
+  }
+
+private:
+  float tau_ = 0, y1_ = 0, y2_ = 0;
+  bool  init_ = false, shown_ = false;
+};
@@ -0,0 +1,183 @@
+#include "Bench.h"
+#include "Config.h"
+#include "Shared.h"
+#include "SensorMS5525.h"
+#include "MS5525Comp.h"
+#include "EnvSensor.h"
+#include "StreamStats.h"
+#include "LogFormat.h"
+#include "JsonWriter.h"
+#include "Snapshot.h"
+#include <WebServer.h>
+#include <math.h>
+
+// Results land here so the compiler cannot drop the measured work
+static volatile float    sinkF;
+static volatile uint32_t sinkU;
+
+// Pseudo-random inputs (xorshift) so branches/operands vary per iteration
+static uint32_t rng = 0x12345678;
+static inline uint32_t rnd(){ rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; }
+static inline float rndf(float lo, float hi){ return lo + (hi - lo) * (rnd() & 0xFFFF) / 65535.0f; }
+
+typedef void (*BenchFn)(uint32_t n);
+
+static void bCompute(uint32_t n){
+  uint16_t C[8]; sensorProm(C);
+  Ms5525Coef k; ms5525Prepare(C, MS5525_P_SCALE, k);
+  float P, T, acc = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    ms5525Convert(k, 8000000 + (rnd() & 0x3FFFF), 8200000 + (rnd() & 0xFFFF), P, T);
+    acc += P;
+  }
+  sinkF = acc;
+}
+
+static void bRho(uint32_t n){
+  float acc = 0;
+  for (uint32_t i = 0; i < n; i++) acc += envComputeRho(rndf(95000, 103000), rndf(-5, 35), rndf(10, 90), true);
+  sinkF = acc;
+}
+
+static void bAirspeed(uint32_t n){
+  float acc = 0;
+  const float r = 1.2f;
+  for (uint32_t i = 0; i < n; i++) acc += sqrtf(2.0f * fabsf(rndf(-400, 400)) / r);
+  sinkF = acc;
+}
+
+// Per-sample cost of the 1 Hz aggregator (StreamStats::add), bins of 50
+static void bAggAdd(uint32_t n){
+  static StreamStats<AGG_EXACT_N> st;
+  st.reset();
+  for (uint32_t i = 0; i < n; i++) {
+    if (i % 50 == 0) st.reset();
+    st.add(rndf(-5, 5));
+  }
+  sinkF = st.mean;
+}
+
+// Bin close: median + spread columns of a full bin
+static void bAggClose(uint32_t n){
+  static StreamStats<AGG_EXACT_N> st;
+  st.reset();
+  for (int i = 0; i < 50; i++) st.add(rndf(-5, 5));
+  float acc = 0;
+  for (uint32_t i = 0; i < n; i++) acc += st.median() + st.p05() + st.p95() + st.stddev();
+  sinkF = acc;
+}
+
+static LogSchema benchSchema(){
+  LogSchema s;
+  const char* names[12] = { "dp_Pa", "Va_mps", "tempP_C", "tempEnv_C", "absP_Pa", "RH_pct", "rho_kgm3",
+                            "dp_min_Pa", "dp_max_Pa", "dp_std_Pa", "dp_p05_Pa", "dp_p95_Pa" };
+  const uint32_t scale[12] = { 10000, 10000, 1000, 1000, 10, 10, 10000, 10000, 10000, 10000, 10000, 10000 };
+  for (int i = 0; i < 12; i++) s.add(names[i], scale[i]);
+  return s;
+}
+
+// A typical 1 Hz row; each iteration advances time and nudges ΔP
+static void fillRow(LogRow& r){
+  r.unix_ms = 1700000000000ULL;
+  r.time_ms = 0;
+  const float base[12] = { 12, 4.4f, 24, 23, 101325, 45, 1.2f, 10, 14, 0.8f, 10.5f, 13.5f };
+  for (int k = 0; k < 12; k++) r.v[k] = base[k];
+}
+static inline void nextRow(LogRow& r){ r.unix_ms += 1000; r.time_ms += 1000; r.v[0] += rndf(-0.05f, 0.05f); }
+
+static void bCsvRow(uint32_t n){
+  static LogSchema s = benchSchema();
+  LogRow r; char line[256]; uint32_t acc = 0;
+  fillRow(r);
+  for (uint32_t i = 0; i < n; i++) { nextRow(r); acc += logFormatCsv(s, r, line, sizeof(line)); }
+  sinkU = acc;
+}
+
+static void bBinRow(uint32_t n){
+  static LogSchema s = benchSchema();
+  static LogBlockEncoder enc;
+  LogRow r; uint32_t acc = 0;
+  fillRow(r);
+  enc.begin(&s, 0);
+  for (uint32_t i = 0; i < n; i++) {
+    nextRow(r);
+    if (!enc.add(r)) { acc += enc.finish()[0]; enc.begin(&s, i); enc.add(r); }
+  }
+  sinkU = acc;
+}
+
+// /api/sample document into a scratch buffer: the serializer alone, the
+// published snapshot and the app state are left alone
+static void bSnapshot(uint32_t n){
+  static char buf[SNAPSHOT_BUF];
+  Sample l = {};
+  l.t_ms = 123456; l.dp_Pa = 12.3456f; l.temp_C = 23.45f; l.Va_mps = 4.44f; l.dp_s = 12.3f; l.tc_s = 23.4f;
+  for (float& a : l.auxDp_Pa) a = 1.5f;
+  const SnapshotEnv e{ 1700000000000LL, 1.2f, 101325, 23, 45, true, true, "/log_12_345678.bin" };
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < n; i++) { l.dp_Pa += rndf(-0.05f, 0.05f); acc += snapshotFormat(l, e, i, buf, sizeof(buf)); }
+  sinkU = acc;
+}
+
+struct BenchCase { const char* name; BenchFn fn; };
+static const BenchCase CASES[] = {
+  { "ms5525_compute", bCompute  },
+  { "env_rho",        bRho      },
+  { "airspeed",       bAirspeed },
+  { "agg_add",        bAggAdd   },
+  { "agg_close",      bAggClose },
+  { "csv_row",        bCsvRow   },
+  { "bin_row",        bBinRow   },
+  { "sample_json",    bSnapshot },
+};
+static_assert(sizeof(CASES) / sizeof(CASES[0]) == BENCH_CASES, "BENCH_CASES");
+
+// Cycles of the loop overhead + input generation alone, subtracted below
+static void bBaseline(uint32_t n){
+  float acc = 0;
+  for (uint32_t i = 0; i < n; i++) acc += rndf(0, 1);
+  sinkF = acc;
+}
+
+static uint32_t bestCycles(BenchFn fn, uint32_t n){
+  uint32_t best = UINT32_MAX;
+  for (uint8_t r = 0; r < BENCH_REPEATS; r++) {
+    const uint32_t c0 = ESP.getCycleCount();
+    fn(n);
+    const uint32_t c = ESP.getCycleCount() - c0;
+    if (c < best) best = c;
+  }
+  return best;
+}
+
+uint8_t benchRun(uint32_t n, BenchResult* out, uint8_t cap, float& baseline){
+  const uint32_t base = bestCycles(bBaseline, n);
+  baseline = (float)base / n;
+  uint8_t k = 0;
+  for (const BenchCase& c : CASES) {
+    if (k >= cap) break;
+    const uint32_t cyc = bestCycles(c.fn, n);
+    out[k++] = { c.name, (float)(cyc < base ? cyc : cyc - base) / n };
+    yield();
+  }
+  return k;
+}
+
+void benchJSON(WebServer& server){
+  uint32_t n = server.hasArg("n") ? (uint32_t)server.arg("n").toInt() : BENCH_DEFAULT_N;
+  if (n < 1) n = 1;
+  if (n > BENCH_MAX_N) n = BENCH_MAX_N;
+
+  const uint32_t mhz = ESP.getCpuFreqMHz();
+  BenchResult res[BENCH_CASES];
+  float base;
+  const uint8_t k = benchRun(n, res, BENCH_CASES, base);
+
+  char buf[1024];
+  JsonWriter j(buf, sizeof(buf));
+  j.obj().kvu("cpu_mhz", mhz).kvu("n", n).kvf("baseline_cycles", base, 1).arr("results");
+  for (uint8_t i = 0; i < k; i++)
+    j.obj().kvs("name", res[i].name).kvf("cycles", res[i].cycles, 1).kvf("ns", res[i].cycles * 1000.0f / mhz, 1).end();
+  j.end().end();
+  server.send_P(200, "application/json", j.c_str(), j.length());
+}
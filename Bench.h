@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+
+class WebServer;
+
+// On-target microbenchmarks of the per-sample / per-row hot paths, timed with
+// the CPU cycle counter. GET /api/bench[?n=<iterations>] runs the suite in
+// the HTTP task without AppLock — every case works on its own inputs and
+// scratch buffers, so the app task keeps draining the ring — and answers
+//   {"cpu_mhz":240,"n":2000,"results":[{"name":…,"cycles":…,"ns":…},…]}
+// cycles/ns are per operation, best of BENCH_REPEATS runs.
+void benchJSON(WebServer& server);
+
+// The suite itself (also run by the host bench, test/bench_main.cpp):
+// cycles per operation with the loop/input baseline subtracted
+constexpr uint8_t BENCH_CASES = 8;
+struct BenchResult { const char* name; float cycles; };
+uint8_t benchRun(uint32_t n, BenchResult* out, uint8_t cap, float& baseline);
@@ -1,5 +1,6 @@
 #pragma once
-#define USE_ADAFRUIT_BME280 1
+#define USE_ENV_BME280 1        // BME280/BMP280 on the shared bus (0 = no env sensor)
+#define USE_LITTLEFS   0        // 1 = LittleFS for logs (faster appends on a full FS), 0 = SPIFFS
 
 #include <Arduino.h>
 #include <IPAddress.h>
@@ -8,7 +9,13 @@
 // I2C pins/speed
 constexpr int SDA_PIN   = 21;
 constexpr int SCL_PIN   = 22;
-constexpr uint32_t I2C_HZ = 100000;   // safe; try 400000 on short, clean wiring
+// Bus clock is tuned at boot: each step is kept only if every verification
+// transaction passes; the sampler steps back down if errors climb later.
+static const uint32_t I2C_SPEEDS[] = { 100000, 400000, 1000000 };
+constexpr uint16_t I2C_TIMEOUT_MS  = 10;     // per transaction
+constexpr uint16_t I2C_TUNE_TRIALS = 64;     // verification reads per speed step
+constexpr uint32_t I2C_WATCH_MS    = 1000;   // runtime error-rate window
+constexpr uint16_t I2C_ERR_LIMIT   = 5;      // errors per window → one step down
 
 // I2C addresses
 // NOTE: MS5525 and BME/BMP280 must NOT share the same address.
@@ -17,6 +24,75 @@ constexpr uint8_t MS5525_ADDR  = 0x76; // Holybro/MS5525DSO
 constexpr uint8_t ENV_ADDR_PRI = 0x77; // BME/BMP280 preferred (SDO → 3V3)
 constexpr uint8_t ENV_ADDR_ALT = 0x76; // fallback if you move MS5525 to 0x77
 
+// Extra ΔP sensors (pitot/static array for yaw/pitch), MS5525 each.
+// bus: 0 = Wire, 1 = Wire1 (SDA1/SCL1); mux: TCA9548A channel, -1 = direct.
+// A selected mux channel stays connected, so muxed sensors must not share
+// an address with a direct device on the same bus (e.g. keep the mux on Wire1).
+// Every sensor converts concurrently — adding one doesn't lower the others' rate.
+struct DpAuxCfg { uint8_t bus; uint8_t addr; int8_t mux; };
+constexpr int      SDA1_PIN     = 25;
+constexpr int      SCL1_PIN     = 26;
+constexpr uint8_t  I2C_MUX_ADDR = 0x70;
+constexpr uint8_t  DP_AUX_MAX   = 3;
+constexpr uint8_t  DP_AUX_N     = 0;     // entries of DP_AUX in use (0..DP_AUX_MAX)
+static const DpAuxCfg DP_AUX[DP_AUX_MAX] = { {1, 0x76, 0}, {1, 0x76, 1}, {1, 0x76, 2} };
+
+// Env sensor: own schedule, one burst read per period (ρ changes over seconds)
+constexpr uint8_t ENV_DEFAULT_HZ = 2;
+constexpr uint8_t ENV_MAX_HZ     = 10;
+
+// MS5525 acquisition
+constexpr uint8_t  MS5525_TEMP_EVERY = 10;   // refresh D2 (temperature) every N pressure samples
+constexpr uint8_t  MS5525_OSR_COUNT  = 5;    // OSR256, 512, 1024, 2048, 4096
+constexpr uint8_t  MS5525_OSR_P      = 4;    // default pressure OSR index (4 → OSR4096)
+constexpr uint8_t  MS5525_OSR_T      = 4;    // default temperature OSR index
+constexpr uint16_t MS5525_PROFILE_MS = 2000; // per-OSR dwell of the rate/noise sweep
+
+// Airspeed filter + gate (AirFilter.h): group delay = 2 × τ
+constexpr uint16_t AIR_FILTER_MS     = 50;     // default τ (setting "filtms", 0 = off)
+constexpr uint16_t AIR_FILTER_MAX_MS = 1000;
+constexpr float    AIR_GATE_ON_PA    = 2.0f;   // filtered |ΔP| ≥ this → show speed
+constexpr float    AIR_GATE_OFF_PA   = 1.0f;   // … until it falls below this
+
+// Tasks: acquisition on core 1, aggregation/logging and HTTP on core 0
+constexpr int      SAMPLER_CORE    = 1;
+constexpr int      SAMPLER_PRIO    = 3;      // above the app task
+constexpr uint32_t SAMPLER_STACK   = 4096;
+constexpr int      APP_CORE        = 0;
+constexpr int      APP_PRIO        = 2;      // preempts HTTP
+constexpr uint32_t APP_STACK       = 8192;
+constexpr int      HTTP_PRIO       = 1;      // request parsing + handlers (on APP_CORE)
+constexpr uint32_t HTTP_STACK      = 8192;
+constexpr uint8_t  EXPORT_WORKERS  = 2;      // concurrent /download streams (HTTP_PRIO)
+constexpr uint32_t EXPORT_STACK    = 8192;
+constexpr size_t   SAMPLE_RING_LEN = 256;    // power of two; ~2.5 s at 100 S/s
+
+// Adaptive sampling: after ADAPT_QUIET_MS with |P − zero| < ADAPT_QUIET_PA the
+// sampler paces conversions at ADAPT_QUIET_HZ (sensor idle in between); the
+// first sample with |P − zero| ≥ ADAPT_BURST_PA restores the full OSR-limited rate
+constexpr float    ADAPT_BURST_PA = 2.0f;
+constexpr float    ADAPT_QUIET_PA = 1.0f;
+constexpr uint32_t ADAPT_QUIET_MS = 5000;
+constexpr uint8_t  ADAPT_QUIET_HZ = 5;
+
+// Live push stream (SSE /api/stream)
+constexpr uint32_t DEFAULT_FRAME_MS = 200;   // batch period
+constexpr size_t   LIVE_RING_LEN    = 512;   // samples kept for subscribers (~5 s at 100 S/s)
+constexpr uint8_t  LIVE_MAX_CLIENTS = 3;
+constexpr size_t   LIVE_FRAME_BUF   = 2048;  // one SSE frame; larger batches are split
+constexpr uint32_t LIVE_STALL_MS    = 10000; // subscriber whose socket stays full this long is dropped
+
+constexpr size_t   SNAPSHOT_BUF     = 448;   // pre-serialized /api/sample document
+constexpr size_t   TRACE_BUF        = 2048;  // trace recorder row buffer
+constexpr uint32_t BENCH_DEFAULT_N  = 2000;  // /api/bench iterations per case
+constexpr uint32_t BENCH_MAX_N      = 20000; // keeps the slowest case inside one cycle-counter wrap
+constexpr uint8_t  BENCH_REPEATS    = 3;
+
+// In-RAM history tiers (/api/history), 24 B per point
+constexpr uint16_t HIST_1S_LEN      = 600;   // 10 min at 1 s
+constexpr uint16_t HIST_10S_LEN     = 720;   // 2 h at 10 s
+constexpr uint16_t HIST_60S_LEN     = 720;   // 12 h at 1 min
+
 // Wi-Fi AP/mDNS
 static const char* AP_SSID   = "AeroSensor";
 static const char* AP_PASS   = "aero1234";
@@ -27,4 +103,21 @@ const IPAddress AP_MASK(255,255,255,0);
 
 // Defaults
 constexpr float    DEFAULT_RHO    = 1.225f; // fallback only (auto ρ from env when available)
-constexpr uint32_t DEFAULT_LOG_MS = 1000;   // 1 s (CSV is 1 Hz aggregated)
+constexpr uint32_t DEFAULT_LOG_MS = 1000;   // 1 s (1 Hz aggregated); < 1000 → raw rows, 0 = every sample
+constexpr uint8_t  DEFAULT_LOG_FMT   = 1;      // 0 = CSV, 1 = binary blocks
+constexpr uint32_t DEFAULT_FLUSH_MS  = 30000;  // buffered rows → flash (binary: pads the open block)
+constexpr size_t   LOG_WBUF_SIZE     = 8192;   // preallocated row buffer (~3 s of CSV at 200 Hz)
+constexpr size_t   LOG_WRITE_CHUNK   = 1024;   // flash write granularity between flushes
+constexpr uint32_t LOG_TAIL_FLUSH_MS = 1000;   // commit period (whole rows/blocks) while a /download?tail=1 follows
+constexpr uint32_t LOG_TAIL_POLL_MS  = 500;    // tail reader: watermark poll period
+constexpr uint32_t LOG_INDEX_SPAN    = 2048;   // CSV bytes per index entry (binary: one per block)
+constexpr uint8_t  LOG_INDEX_PENDING = 16;     // index entries buffered until the next flush
+constexpr uint32_t LOG_RAW_BELOW_MS  = 1000;   // logEveryMs below this → raw per-sample rows
+// Storage manager: a logging session is a chain of segment files, rotated by
+// size or age; the oldest segments are deleted to stay inside the budget
+constexpr uint32_t LOG_SEG_BYTES     = 256 * 1024;  // rotate at this size …
+constexpr uint32_t LOG_SEG_MS        = 3600000;     // … or after this long
+constexpr uint8_t  DEFAULT_KEEP_PCT  = 80;          // logs may use this % of the FS (retention budget)
+constexpr uint32_t LOG_RESERVE_BYTES = 32 * 1024;   // always left free (index, metadata, traces)
+constexpr uint32_t STORAGE_CHECK_MS  = 1000;        // background retention: ≤ 1 delete per check
+constexpr uint16_t AGG_EXACT_N       = 64;     // 1 Hz bin: exact ΔP quantiles up to this many samples, P² beyond
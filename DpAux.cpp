@@ -0,0 +1,81 @@
+#include "DpAux.h"
+#include "MS5525Dev.h"
+#include "I2CBus.h"
+#include "Metrics.h"
+
+static WirePort  ports[DP_AUX_MAX] = {
+  WirePort(DP_AUX[0].bus, DP_AUX[0].mux),
+  WirePort(DP_AUX[1].bus, DP_AUX[1].mux),
+  WirePort(DP_AUX[2].bus, DP_AUX[2].mux),
+};
+static_assert(DP_AUX_MAX == 3, "ports[] initialiser");
+static Ms5525Dev devs[DP_AUX_MAX];
+static bool      online[DP_AUX_MAX];
+
+// Readings between two primary samples are averaged, not dropped
+static double    accP[DP_AUX_MAX];
+static uint16_t  accN[DP_AUX_MAX];
+
+void dpAuxBegin(){
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    devs[i].attach(&ports[i], DP_AUX[i].addr);
+    online[i] = devs[i].reset();
+  }
+  delay(3);
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    if (online[i]) online[i] = devs[i].loadProm(MS5525_P_SCALE);
+    Serial.printf("[dp%u] bus %u addr 0x%02X mux %d: %s\n", i + 1, DP_AUX[i].bus,
+                  DP_AUX[i].addr, DP_AUX[i].mux, online[i] ? "ok" : "not found");
+  }
+}
+
+uint8_t dpAuxCount()           { return DP_AUX_N; }
+bool    dpAuxOnline(uint8_t i) { return i < DP_AUX_N && online[i]; }
+void    dpAuxProm(uint8_t i, uint16_t C[8]){ memcpy(C, devs[i % DP_AUX_MAX].prom(), 8 * sizeof(uint16_t)); }
+
+void dpAuxSetup(uint8_t osrP, uint8_t osrT, uint8_t tempEvery){
+  for (uint8_t i = 0; i < DP_AUX_MAX; i++) { devs[i].setOsr(osrP, osrT); devs[i].setTempEvery(tempEvery); }
+}
+
+void dpAuxSetPaced(bool on){
+  for (uint8_t i = 0; i < DP_AUX_MAX; i++) devs[i].setPaced(on);
+}
+
+void dpAuxPoll(){
+  const uint32_t now = micros();
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    if (!online[i]) continue;
+    const Ms5525Dev::Step st = devs[i].poll(now);
+    if (st == Ms5525Dev::Step::Fail || st == Ms5525Dev::Step::StartFail) metricCount(CNT_CONV_FAIL);
+    if (st != Ms5525Dev::Step::Pressure) continue;
+    float P, T;
+    devs[i].convert(P, T);
+    accP[i] += P;
+    if (accN[i] < 0xFFFF) accN[i]++;
+  }
+}
+
+uint32_t dpAuxWaitUs(){
+  const uint32_t now = micros();
+  uint32_t w = UINT32_MAX;
+  for (uint8_t i = 0; i < DP_AUX_N; i++)
+    if (online[i]) w = min(w, devs[i].waitUs(now));
+  return w;
+}
+
+void dpAuxTake(float P_Pa[DP_AUX_MAX]){
+  for (uint8_t i = 0; i < DP_AUX_MAX; i++) {
+    P_Pa[i] = accN[i] ? (float)(accP[i] / accN[i]) : NAN;
+    accP[i] = 0; accN[i] = 0;
+  }
+}
+
+bool dpAuxVerify(){
+  bool ok = true;
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    if (!online[i] || devs[i].converting() != Ms5525Dev::Conv::Idle) continue;
+    uint16_t C[8];
+    ok &= devs[i].readProm(C) && !memcmp(C, devs[i].prom(), sizeof(C));
+  }
+  return ok;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <Arduino.h>
+#include "Config.h"
+
+// Extra ΔP sensors (DP_AUX in Config.h), one Ms5525Dev each on Wire/Wire1,
+// optionally behind a TCA9548A. Driven by the sampler task next to the
+// primary sensor: every device has its own conversion in flight, so the
+// conversions overlap and each sensor keeps the single-sensor rate. Each has
+// its own PROM; zero/invert live in dpAuxZero/dpAuxInvert (Shared.h).
+
+// Reset + PROM of every configured sensor (after busBegin()). A sensor that
+// doesn't answer stays in the list (NaN readings) so log columns are stable.
+void    dpAuxBegin();
+uint8_t dpAuxCount();                  // DP_AUX_N
+bool    dpAuxOnline(uint8_t i);
+void    dpAuxProm(uint8_t i, uint16_t C[8]);
+
+// OSR / temperature cadence (same as the primary, see sensorSetOsr)
+void    dpAuxSetup(uint8_t osrP, uint8_t osrT, uint8_t tempEvery);
+
+// Adaptive rate (see sensorSetPaced)
+void    dpAuxSetPaced(bool on);
+
+// Sampler task: advance every state machine (never waits)
+void     dpAuxPoll();
+// µs until the next conversion is ready (UINT32_MAX with no sensors)
+uint32_t dpAuxWaitUs();
+// Mean compensated P of each sensor since the last take (NaN = no new
+// reading); called once per primary sample
+void     dpAuxTake(float P_Pa[DP_AUX_MAX]);
+
+// Bus tuning: PROM readback of every online sensor
+bool    dpAuxVerify();
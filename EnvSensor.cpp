@@ -1,31 +1,171 @@
 #include "EnvSensor.h"
 #include "Config.h"
+#include "Metrics.h"
 #include <math.h>
 
-#if USE_ADAFRUIT_BME280
-  #include <Adafruit_BME280.h>
-  static Adafruit_BME280 bme;
-  static bool g_has=false, g_hasHum=false;
+#if USE_ENV_BME280
+  #include <Wire.h>
+
+  // Register-level BME280/BMP280 driver: normal mode with the standby time
+  // matched to envSetRateHz(), and one burst read of the data registers
+  // (0xF7…0xFE) per period instead of three library calls that each re-read
+  // temperature. Bosch integer compensation (datasheet §4.2.3).
+  constexpr uint8_t REG_CALIB0 = 0x88, REG_ID = 0xD0, REG_RESET = 0xE0, REG_CALIB1 = 0xE1;
+  constexpr uint8_t REG_CTRL_HUM = 0xF2, REG_STATUS = 0xF3, REG_CTRL_MEAS = 0xF4, REG_CONFIG = 0xF5;
+  constexpr uint8_t REG_DATA = 0xF7;
+  constexpr uint8_t ID_BMP280 = 0x58, ID_BME280 = 0x60;
+
+  static uint8_t  addr = 0;
+  static bool     g_has = false, g_hasHum = false;
+  static uint8_t  rateHz = ENV_DEFAULT_HZ;
+  static uint32_t periodMs = 1000 / ENV_DEFAULT_HZ, nextMs = 0;
+  static volatile bool reconfig = false;   // rate changed: sampler re-runs configure()
+
+  static uint16_t T1, P1; static int16_t T2, T3, P2, P3, P4, P5, P6, P7, P8, P9;
+  static uint8_t  H1, H3; static int16_t H2, H4, H5; static int8_t H6;
+
+  static bool rd(uint8_t reg, uint8_t* buf, uint8_t n){
+    Wire.beginTransmission(addr);
+    Wire.write(reg);
+    if (metricI2c(Wire.endTransmission(false)) != 0) return false;
+    if (Wire.requestFrom(addr, n, (uint8_t)true) != n) { metricCount(CNT_I2C_SHORT); return false; }
+    for (uint8_t i = 0; i < n; i++) buf[i] = Wire.read();
+    return true;
+  }
+  static bool wr(uint8_t reg, uint8_t v){
+    Wire.beginTransmission(addr);
+    Wire.write(reg); Wire.write(v);
+    return metricI2c(Wire.endTransmission(true)) == 0;
+  }
+  static inline uint16_t le16(const uint8_t* p){ return p[0] | (p[1] << 8); }
+
+  static bool readCalib(){
+    uint8_t c[26];
+    if (!rd(REG_CALIB0, c, sizeof(c))) return false;
+    T1 = le16(c+0);  T2 = le16(c+2);  T3 = le16(c+4);
+    P1 = le16(c+6);  P2 = le16(c+8);  P3 = le16(c+10); P4 = le16(c+12); P5 = le16(c+14);
+    P6 = le16(c+16); P7 = le16(c+18); P8 = le16(c+20); P9 = le16(c+22);
+    H1 = c[25];
+    if (!g_hasHum) return true;
+    uint8_t h[7];
+    if (!rd(REG_CALIB1, h, sizeof(h))) return false;
+    H2 = le16(h+0); H3 = h[2];
+    H4 = (int16_t)((int8_t)h[3] * 16 | (h[4] & 0x0F));
+    H5 = (int16_t)((int8_t)h[5] * 16 | (h[4] >> 4));
+    H6 = (int8_t)h[6];
+    return true;
+  }
+
+  // Largest standby (t_sb) that still gives a fresh result every period
+  static uint8_t standbyCode(uint32_t period){
+    static const uint16_t TSB_MS[] = { 1, 63, 125, 250, 500, 1000 };   // codes 0…5 (0.5 → 1)
+    uint8_t code = 0;
+    for (uint8_t k = 0; k < 6; k++) if ((uint32_t)TSB_MS[k] + 20 <= period / 2) code = k;
+    return code;
+  }
+
+  static bool configure(){
+    // osrs_h ×1, osrs_t ×2, osrs_p ×4 (~18 ms measurement), IIR ×4, normal mode.
+    // Writes to config may be ignored in normal mode: sleep first.
+    const uint8_t meas = (2 << 5) | (3 << 2);
+    if (!wr(REG_CTRL_MEAS, meas)) return false;                  // mode 00: sleep
+    if (g_hasHum && !wr(REG_CTRL_HUM, 0x01)) return false;      // must precede ctrl_meas
+    if (!wr(REG_CONFIG, (uint8_t)((standbyCode(periodMs) << 5) | (2 << 2)))) return false;
+    return wr(REG_CTRL_MEAS, meas | 0x03);
+  }
+
+  static bool probe(uint8_t a){
+    addr = a;
+    uint8_t id = 0;
+    if (!rd(REG_ID, &id, 1) || (id != ID_BME280 && id != ID_BMP280)) return false;
+    g_hasHum = (id == ID_BME280);
+    wr(REG_RESET, 0xB6);
+    delay(3);
+    for (int i = 0; i < 10; i++) {                               // NVM copy done?
+      uint8_t st = 1;
+      if (rd(REG_STATUS, &st, 1) && !(st & 0x01)) break;
+      delay(2);
+    }
+    return readCalib() && configure();
+  }
 
   void envBegin() {
-    if (bme.begin(ENV_ADDR_PRI)) { g_has = true; g_hasHum = (bme.sensorID() != 0x58); return; }
-    if (bme.begin(ENV_ADDR_ALT)) { g_has = true; g_hasHum = (bme.sensorID() != 0x58); return; }
-    g_has = false; g_hasHum = false;
+    g_has = probe(ENV_ADDR_PRI) || probe(ENV_ADDR_ALT);
+    if (!g_has) g_hasHum = false;
+    reconfig = false;                                            // probe() configured it
+    nextMs = millis();
   }
   bool envAvailable(){ return g_has; }
 
+  bool envVerify(){
+    uint8_t id = 0, c[6];
+    if (!rd(REG_ID, &id, 1) || id != (g_hasHum ? ID_BME280 : ID_BMP280)) return false;
+    if (!rd(REG_CALIB0, c, sizeof(c))) return false;
+    return le16(c+0) == T1 && (int16_t)le16(c+2) == T2 && (int16_t)le16(c+4) == T3;
+  }
+
+  // Any task: the bus belongs to the sampler (I2CBus.h), which applies the
+  // new standby time at its next scheduled read
+  void envSetRateHz(uint8_t hz){
+    rateHz   = constrain<uint8_t>(hz, 1, ENV_MAX_HZ);
+    periodMs = 1000 / rateHz;
+    reconfig = true;
+  }
+  uint8_t envRateHz(){ return rateHz; }
+
   bool envRead(float &p_Pa, float &t_C, float &rh_pct, bool &hasHumidity){
     if (!g_has) return false;
-    t_C = bme.readTemperature();
-    p_Pa = bme.readPressure();   // Pa
-    if (isnan(t_C) || isnan(p_Pa)) return false;
-    if (g_hasHum) { rh_pct = bme.readHumidity(); hasHumidity = !isnan(rh_pct); }
-    else { rh_pct = 0.0f; hasHumidity = false; }
+    const uint32_t now = millis();
+    if ((int32_t)(now - nextMs) < 0) return false;              // not due: no bus traffic
+    nextMs += periodMs;
+    if ((int32_t)(now - nextMs) > 0) nextMs = now + periodMs;   // fell behind: resync
+    if (reconfig) { reconfig = false; if (!configure()) { reconfig = true; return false; } }
+
+    uint8_t d[8];
+    if (!rd(REG_DATA, d, g_hasHum ? 8 : 6)) return false;
+    const int32_t adcP = ((int32_t)d[0] << 12) | (d[1] << 4) | (d[2] >> 4);
+    const int32_t adcT = ((int32_t)d[3] << 12) | (d[4] << 4) | (d[5] >> 4);
+    if (adcT == 0x80000 || adcP == 0x80000) return false;       // no conversion yet
+
+    int32_t v1 = ((((adcT >> 3) - ((int32_t)T1 << 1))) * T2) >> 11;
+    int32_t v2 = (((((adcT >> 4) - (int32_t)T1) * ((adcT >> 4) - (int32_t)T1)) >> 12) * T3) >> 14;
+    const int32_t tFine = v1 + v2;
+    t_C = ((tFine * 5 + 128) >> 8) / 100.0f;
+
+    int64_t a = (int64_t)tFine - 128000;
+    int64_t b = a * a * P6;
+    b += (a * P5) << 17;
+    b += (int64_t)P4 << 35;
+    a  = ((a * a * P3) >> 8) + ((a * P2) << 12);
+    a  = ((((int64_t)1) << 47) + a) * P1 >> 33;
+    if (a == 0) return false;
+    int64_t p = 1048576 - adcP;
+    p  = (((p << 31) - b) * 3125) / a;
+    const int64_t c1 = ((int64_t)P9 * (p >> 13) * (p >> 13)) >> 25;
+    const int64_t c2 = ((int64_t)P8 * p) >> 19;
+    p  = ((p + c1 + c2) >> 8) + ((int64_t)P7 << 4);
+    p_Pa = (float)p / 256.0f;
+
+    if (g_hasHum) {
+      const int32_t adcH = (d[6] << 8) | d[7];
+      int32_t h = tFine - 76800;
+      h = (((((adcH << 14) - ((int32_t)H4 << 20) - ((int32_t)H5 * h)) + 16384) >> 15) *
+           (((((((h * H6) >> 10) * (((h * (int32_t)H3) >> 11) + 32768)) >> 10) + 2097152) * H2 + 8192) >> 14));
+      h -= (((((h >> 15) * (h >> 15)) >> 7) * (int32_t)H1) >> 4);
+      h = h < 0 ? 0 : (h > 419430400 ? 419430400 : h);
+      rh_pct = (h >> 12) / 1024.0f;
+      hasHumidity = true;
+    } else {
+      rh_pct = 0.0f; hasHumidity = false;
+    }
     return true;
   }
 #else
   void envBegin() {}
   bool envAvailable(){ return false; }
+  bool envVerify(){ return true; }
+  void envSetRateHz(uint8_t hz){ (void)hz; }
+  uint8_t envRateHz(){ return 0; }
   bool envRead(float &p_Pa, float &t_C, float &rh_pct, bool &hasHumidity){
     (void)p_Pa; (void)t_C; (void)rh_pct; (void)hasHumidity; return false;
   }
@@ -7,7 +7,16 @@ void envBegin();
 // Returns true if a sensor was found
 bool envAvailable();
 
-// Read latest env values; returns true if fresh data
+// Bus check for speed tuning: chip id + calibration readback
+bool envVerify();
+
+// Env sampling schedule (1…ENV_MAX_HZ); the sensor's standby time follows it
+// (reprogrammed by the sampler task at its next scheduled read)
+void    envSetRateHz(uint8_t hz);
+uint8_t envRateHz();
+
+// Read latest env values; returns true if fresh data. Cheap to call often:
+// the bus is only touched once per 1/envRateHz() (one burst read).
 // p_Pa (Pa), t_C (°C), rh_pct (0..100), hasHumidity=true for BME280
 bool envRead(float &p_Pa, float &t_C, float &rh_pct, bool &hasHumidity);
 
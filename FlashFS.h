@@ -0,0 +1,12 @@
+#pragma once
+// Flash filesystem for logs, index side files and traces. SPIFFS by default;
+// USE_LITTLEFS=1 (Config.h) switches to LittleFS, whose appends don't slow
+// down as the partition fills. Both mount the same "spiffs" data partition.
+#include "Config.h"
+#if USE_LITTLEFS
+  #include <LittleFS.h>
+  #define FLASHFS LittleFS
+#else
+  #include <SPIFFS.h>
+  #define FLASHFS SPIFFS
+#endif
@@ -0,0 +1,136 @@
+#include "History.h"
+#include "Config.h"
+#include "Shared.h"
+#include "JsonWriter.h"
+#include <WebServer.h>
+
+// Quantized to int16 so a point is 24 B: ΔP 0.1 Pa (±3276 Pa), airspeed and
+// temperature 0.01 (±327). INT16_MIN marks "no data".
+struct HistPoint {
+  uint32_t t;            // unix seconds of the bucket start
+  int16_t  v[9];         // dp min/mean/max, va min/mean/max, tc min/mean/max
+};
+
+static const float   SCALE[9]    = { 10, 10, 10, 100, 100, 100, 100, 100, 100 };
+static const uint8_t DECIMALS[9] = { 1, 1, 1, 2, 2, 2, 2, 2, 2 };
+
+static int16_t q16(float v, float scale){
+  if (isnan(v)) return INT16_MIN;
+  float q = roundf(v * scale);
+  if (q >  32767.0f) q =  32767.0f;
+  if (q < -32767.0f) q = -32767.0f;
+  return (int16_t)q;
+}
+
+struct Tier {
+  uint16_t   res;        // seconds per point
+  uint16_t   len;
+  HistPoint* buf;
+  uint32_t   head = 0;   // points written
+  // open bucket (coarse tiers): aggregate of the 1 s points in it
+  uint32_t   key = 0;
+  bool       open = false;
+  HistAcc    acc[9];     // [ch*3 + 0/1/2] → min of mins / mean of means / max of maxes
+};
+
+static HistPoint buf1[HIST_1S_LEN], buf10[HIST_10S_LEN], buf60[HIST_60S_LEN];
+static Tier tiers[] = {
+  { 1,  HIST_1S_LEN,  buf1  },
+  { 10, HIST_10S_LEN, buf10 },
+  { 60, HIST_60S_LEN, buf60 },
+};
+
+static void tierPush(Tier& t, uint32_t sec, const float* v){
+  HistPoint& p = t.buf[t.head % t.len];
+  p.t = sec;
+  for (int i = 0; i < 9; i++) p.v[i] = q16(v[i], SCALE[i]);
+  t.head++;
+}
+
+static void tierClose(Tier& t){
+  if (!t.open) return;
+  float v[9];
+  for (int c = 0; c < 3; c++) {
+    v[c*3 + 0] = t.acc[c*3 + 0].stat().min;
+    v[c*3 + 1] = t.acc[c*3 + 1].stat().mean;
+    v[c*3 + 2] = t.acc[c*3 + 2].stat().max;
+  }
+  tierPush(t, t.key * t.res, v);
+  t.open = false;
+}
+
+void historyAdd(uint32_t sec, const HistStat& dp, const HistStat& va, const HistStat& tc){
+  const float v[9] = { dp.min, dp.mean, dp.max, va.min, va.mean, va.max, tc.min, tc.mean, tc.max };
+  for (Tier& t : tiers) {
+    if (t.res == 1) { tierPush(t, sec, v); continue; }
+    const uint32_t key = sec / t.res;
+    if (t.open && key != t.key) tierClose(t);
+    if (!t.open) {
+      for (HistAcc& a : t.acc) a.reset();
+      t.key = key; t.open = true;
+    }
+    for (int i = 0; i < 9; i++) t.acc[i].add(v[i]);
+  }
+}
+
+static void sendChunk(const char* p, size_t n, void* ctx){
+  ((WebServer*)ctx)->sendContent(p, n);
+}
+
+// Points copied per AppLock hold; the reply is streamed without the lock
+constexpr uint16_t HIST_CHUNK = 48;
+
+void historyJSON(WebServer& server){
+  const int res = server.hasArg("res") ? server.arg("res").toInt() : 10;
+  Tier* t = nullptr;
+  for (Tier& x : tiers) if (x.res == res) t = &x;
+  if (!t) { server.send(400, "text/plain", "res must be 1, 10 or 60"); return; }
+
+  long long since = server.hasArg("since") ? atoll(server.arg("since").c_str()) : 0;
+  uint32_t i, end, t0, sinceSec;
+  {
+    AppLock g;
+    if (since < 0) since += g_timeOffsetMs + (long long)millis();
+    sinceSec = since > 0 ? (uint32_t)(since / 1000) : 0;
+    const uint32_t n = t->head < t->len ? t->head : t->len;
+    end = t->head;                              // points added while we send wait for the next request
+    i = end - n;
+    while (i < end && t->buf[i % t->len].t < sinceSec) i++;
+    t0 = i < end ? t->buf[i % t->len].t : 0;
+  }
+
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char buf[512];
+  JsonWriter j(buf, sizeof(buf), sendChunk, &server);
+  j.obj().kvu("res", t->res).kvu("t0", t0);
+
+  j.arr("cols");
+  static const char* COLS[9] = { "dp_min", "dp", "dp_max", "va_min", "va", "va_max", "tc_min", "tc", "tc_max" };
+  for (const char* c : COLS) j.kvs(nullptr, c);
+  j.end();
+
+  j.arr("d");
+  HistPoint chunk[HIST_CHUNK];
+  for (;;) {
+    uint16_t k = 0;
+    {
+      AppLock g;
+      if (t->head - i > t->len) i = t->head - t->len;   // overwritten while a chunk was sent
+      for (; i < end && k < HIST_CHUNK; i++) chunk[k++] = t->buf[i % t->len];
+    }
+    if (!k) break;
+    for (uint16_t c = 0; c < k; c++) {
+      const HistPoint& p = chunk[c];
+      if (p.t < sinceSec) continue;             // clock was re-synced backwards
+      j.arr().kvi(nullptr, (int64_t)p.t - (int64_t)t0);
+      for (int m = 0; m < 9; m++)
+        j.kvf(nullptr, p.v[m] == INT16_MIN ? NAN : p.v[m] / SCALE[m], DECIMALS[m]);
+      j.end();
+    }
+  }
+  j.end().end();
+  j.flush();
+  server.sendContent("", 0);
+}
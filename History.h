@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include <math.h>
+
+class WebServer;
+
+// On-device history at 1 s / 10 s / 1 min resolution (min/mean/max of ΔP,
+// airspeed and temperature), fed once per closed 1 Hz bin by the aggregator
+// and served by /api/history so a (re)connecting client can backfill.
+
+struct HistStat { float min, mean, max; };
+
+// Running min/mean/max of one channel within a bin (NaN samples ignored)
+struct HistAcc {
+  float    mn, mx;
+  double   sum;
+  uint32_t n;
+  void reset() { mn = mx = NAN; sum = 0; n = 0; }
+  void add(float x) {
+    if (isnan(x)) return;
+    if (!n || x < mn) mn = x;
+    if (!n || x > mx) mx = x;
+    sum += x; n++;
+  }
+  HistStat stat() const { return HistStat{ mn, n ? (float)(sum / n) : NAN, mx }; }
+};
+
+// App task: one closed 1 Hz bin (sec = unix seconds of the bin)
+void historyAdd(uint32_t sec, const HistStat& dp, const HistStat& va, const HistStat& tc);
+
+// HTTP handler body for /api/history?res=1|10|60&since=<unix ms, negative = ago>
+//   {"res":10,"t0":<unix s>,"cols":[...],"d":[[dt_s,dp_min,dp,dp_max,va_min,...],...]}
+// Takes AppLock itself, only to copy a few dozen points at a time: the
+// reply is streamed without it, so a slow client never stalls the app task
+void historyJSON(WebServer& server);
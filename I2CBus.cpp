@@ -0,0 +1,101 @@
+#include "I2CBus.h"
+#include "Config.h"
+#include "Metrics.h"
+#include "SensorMS5525.h"
+#include "EnvSensor.h"
+#include "DpAux.h"
+#include <Wire.h>
+
+constexpr uint8_t N_SPEEDS = sizeof(I2C_SPEEDS) / sizeof(I2C_SPEEDS[0]);
+static uint8_t  speed = 0;
+static uint32_t fallbacks = 0;
+static uint32_t watchT0 = 0, watchErr0 = 0;
+static bool     bus1 = false;          // Wire1 started (an extra ΔP sensor uses it)
+static int8_t   muxSel[2] = { -1, -1 };
+
+static TwoWire& wire(uint8_t bus){ return bus ? Wire1 : Wire; }
+
+static void setSpeed(uint8_t k){
+  speed = k;
+  Wire.setClock(I2C_SPEEDS[k]);
+  if (bus1) Wire1.setClock(I2C_SPEEDS[k]);
+}
+
+static uint32_t busErrors(){
+  return metricGet(CNT_I2C_NACK) + metricGet(CNT_I2C_TIMEOUT) + metricGet(CNT_I2C_SHORT) + metricGet(CNT_I2C_OTHER);
+}
+
+void busBegin(){
+  Wire.begin(SDA_PIN, SCL_PIN, I2C_SPEEDS[0]);
+  Wire.setTimeOut(I2C_TIMEOUT_MS);
+  for (uint8_t i = 0; i < DP_AUX_N; i++) bus1 |= DP_AUX[i].bus == 1;
+  if (bus1) {
+    Wire1.begin(SDA1_PIN, SCL1_PIN, I2C_SPEEDS[0]);
+    Wire1.setTimeOut(I2C_TIMEOUT_MS);
+  }
+  speed = 0;
+}
+
+uint32_t busTune(){
+  uint8_t good = 0;
+  for (uint8_t k = 1; k < N_SPEEDS; k++) {
+    setSpeed(k);
+    delay(2);
+    uint16_t fails = 0;
+    for (uint16_t i = 0; i < I2C_TUNE_TRIALS; i++) {
+      if (!sensorVerify()) fails++;
+      if (envAvailable() && !envVerify()) fails++;
+      if (!dpAuxVerify()) fails++;
+    }
+    Serial.printf("[i2c] %lu Hz: %u/%u verification errors\n",
+                  (unsigned long)I2C_SPEEDS[k], fails, I2C_TUNE_TRIALS);
+    if (fails) break;
+    good = k;
+  }
+  setSpeed(good);
+  watchT0 = millis(); watchErr0 = busErrors();
+  Serial.printf("[i2c] bus clock %lu Hz\n", (unsigned long)I2C_SPEEDS[good]);
+  return I2C_SPEEDS[good];
+}
+
+void busWatch(uint32_t now_ms){
+  if (now_ms - watchT0 < I2C_WATCH_MS) return;
+  const uint32_t err = busErrors();
+  if (err - watchErr0 > I2C_ERR_LIMIT && speed > 0) {
+    setSpeed(speed - 1);
+    fallbacks++;
+    Serial.printf("[i2c] %lu errors/%lums → falling back to %lu Hz\n",
+                  (unsigned long)(err - watchErr0), (unsigned long)I2C_WATCH_MS, (unsigned long)I2C_SPEEDS[speed]);
+  }
+  watchT0 = now_ms; watchErr0 = err;
+}
+
+uint32_t busHz()        { return I2C_SPEEDS[speed]; }
+uint32_t busFallbacks() { return fallbacks; }
+
+// ---------- Wire ports ----------
+bool WirePort::select(){
+  if (mux_ < 0 || muxSel[bus_] == mux_) return true;
+  TwoWire& w = wire(bus_);
+  w.beginTransmission(I2C_MUX_ADDR);
+  w.write((uint8_t)(1u << mux_));
+  if (metricI2c(w.endTransmission(true)) != 0) { muxSel[bus_] = -1; return false; }
+  muxSel[bus_] = mux_;
+  return true;
+}
+
+uint8_t WirePort::write(uint8_t addr, uint8_t cmd, bool stop){
+  if (!select()) return 4;                  // "other error"
+  TwoWire& w = wire(bus_);
+  w.beginTransmission(addr);
+  w.write(cmd);
+  return metricI2c(w.endTransmission(stop));
+}
+
+uint8_t WirePort::read(uint8_t addr, uint8_t* p, uint8_t n){
+  TwoWire& w = wire(bus_);
+  const uint8_t got = w.requestFrom(addr, n, (uint8_t)true);
+  for (uint8_t i = 0; i < got && i < n; i++) p[i] = w.read();
+  if (got != n) metricCount(CNT_I2C_SHORT);
+  return got;
+}
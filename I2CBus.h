@@ -0,0 +1,38 @@
+#pragma once
+#include <Arduino.h>
+#include "MS5525Dev.h"
+
+// Shared I2C bus (MS5525 + BME/BMP280). All runtime transactions are issued
+// by the sampler task, which interleaves them: env burst reads run while an
+// MS5525 conversion is in flight, so the two sensors never wait on each other.
+// This module owns the clock: it is tuned upward at boot and stepped back
+// down when the error rate climbs.
+
+// Wire (and Wire1 when an extra ΔP sensor uses it) at the lowest speed
+// (call before sensorBegin/envBegin/dpAuxBegin)
+void busBegin();
+
+// Probe I2C_SPEEDS upward; keep the fastest step where every verification
+// transaction (MS5525 PROM readback, env chip id/calibration) succeeded.
+// Call once from setup(), after the sensors are initialised.
+uint32_t busTune();
+
+// Sampler task: step down one speed when I2C errors exceed I2C_ERR_LIMIT per window
+void busWatch(uint32_t now_ms);
+
+uint32_t busHz();
+uint32_t busFallbacks();
+
+// Wire (bus 0) / Wire1 (bus 1) as an I2cPort with Metrics accounting. With
+// mux ≥ 0 the TCA9548A at I2C_MUX_ADDR on that bus is switched to the channel
+// first (only when it changed). Used from the sampler task / setup() only.
+class WirePort : public I2cPort {
+public:
+  explicit WirePort(uint8_t bus = 0, int8_t mux = -1) : bus_(bus), mux_(mux) {}
+  uint8_t write(uint8_t addr, uint8_t cmd, bool stop) override;
+  uint8_t read(uint8_t addr, uint8_t* p, uint8_t n) override;
+private:
+  bool    select();
+  uint8_t bus_;
+  int8_t  mux_;
+};
@@ -0,0 +1,78 @@
+#include "JsonWriter.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+void JsonWriter::flush() {
+  if (sink_ && n_) { sink_(b_, n_, ctx_); n_ = 0; b_[0] = 0; }
+}
+
+void JsonWriter::put(const char* p, size_t n) {
+  while (n) {
+    if (n_ + 1 >= cap_) {                 // keep room for the terminator
+      if (!sink_ || !n_) { over_ = true; return; }
+      flush();
+    }
+    size_t k = cap_ - 1 - n_;
+    if (k > n) k = n;
+    memcpy(b_ + n_, p, k);
+    n_ += k; p += k; n -= k;
+    b_[n_] = 0;
+  }
+}
+
+void JsonWriter::fmt(const char* f, ...) {
+  char tmp[40];
+  va_list ap;
+  va_start(ap, f);
+  int n = vsnprintf(tmp, sizeof(tmp), f, ap);
+  va_end(ap);
+  if (n > 0) put(tmp, (size_t)n < sizeof(tmp) ? (size_t)n : sizeof(tmp) - 1);
+}
+
+void JsonWriter::key(const char* k) {
+  if (first_ & (1u << depth_)) first_ &= ~(1u << depth_);
+  else putc_(',');
+  if (k) { putc_('"'); put(k, strlen(k)); put("\":", 2); }
+}
+
+void JsonWriter::open(const char* k, char c) {
+  key(k);
+  putc_(c);
+  if (depth_ + 1 < (int)sizeof(close_)) {
+    close_[depth_++] = (c == '{') ? '}' : ']';
+    first_ |= (1u << depth_);
+  } else {
+    over_ = true;
+  }
+}
+
+JsonWriter& JsonWriter::end() {
+  if (depth_) putc_(close_[--depth_]);
+  return *this;
+}
+
+JsonWriter& JsonWriter::kvs(const char* k, const char* v) {
+  key(k);
+  putc_('"');
+  for (const char* p = v ? v : ""; *p; p++) {
+    const char c = *p;
+    if (c == '"' || c == '\\') { putc_('\\'); putc_(c); }
+    else if ((unsigned char)c < 0x20) fmt("\\u%04x", (unsigned)c);
+    else putc_(c);
+  }
+  putc_('"');
+  return *this;
+}
+
+JsonWriter& JsonWriter::kvb(const char* k, bool v) { key(k); v ? put("true", 4) : put("false", 5); return *this; }
+JsonWriter& JsonWriter::kvi(const char* k, int64_t v) { key(k); fmt("%lld", (long long)v); return *this; }
+JsonWriter& JsonWriter::kvu(const char* k, uint64_t v) { key(k); fmt("%llu", (unsigned long long)v); return *this; }
+
+JsonWriter& JsonWriter::kvf(const char* k, float v, uint8_t decimals) {
+  key(k);
+  if (isnan(v) || isinf(v)) put("null", 4);
+  else fmt("%.*f", (int)decimals, (double)v);
+  return *this;
+}
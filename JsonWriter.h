@@ -0,0 +1,47 @@
+#pragma once
+// Allocation-free JSON writer into a caller-provided buffer.
+// Commas are inserted automatically. With a sink, the buffer is handed off
+// whenever it runs low, so arbitrarily long documents (file lists) can be
+// streamed through a small stack buffer.
+#include <stddef.h>
+#include <stdint.h>
+
+class JsonWriter {
+public:
+  typedef void (*Sink)(const char* p, size_t n, void* ctx);
+
+  JsonWriter(char* buf, size_t cap, Sink sink = nullptr, void* ctx = nullptr)
+    : b_(buf), cap_(cap), sink_(sink), ctx_(ctx) { if (cap_) b_[0] = 0; }
+
+  JsonWriter& obj(const char* key = nullptr) { open(key, '{'); return *this; }
+  JsonWriter& arr(const char* key = nullptr) { open(key, '['); return *this; }
+  JsonWriter& end();
+
+  JsonWriter& kvs(const char* key, const char* v);              // escaped string
+  JsonWriter& kvb(const char* key, bool v);
+  JsonWriter& kvi(const char* key, int64_t v);
+  JsonWriter& kvu(const char* key, uint64_t v);
+  JsonWriter& kvf(const char* key, float v, uint8_t decimals);  // NaN/inf → null
+
+  const char* c_str()    const { return b_; }
+  size_t      length()   const { return n_; }
+  bool        overflow() const { return over_; }
+  void        flush();                                          // hand everything to the sink
+
+private:
+  void open(const char* key, char c);
+  void key(const char* k);
+  void put(const char* p, size_t n);
+  void putc_(char c) { put(&c, 1); }
+  void fmt(const char* f, ...);
+
+  char*    b_;
+  size_t   cap_;
+  size_t   n_ = 0;
+  bool     over_ = false;
+  uint8_t  depth_ = 0;
+  uint32_t first_ = 1;        // bit d set → nothing written yet at depth d
+  char     close_[16];
+  Sink     sink_;
+  void*    ctx_;
+};
@@ -0,0 +1,147 @@
+#include "LiveStream.h"
+#include "Config.h"
+#include "Logging.h"
+#include <WebServer.h>
+#include <WiFi.h>
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <sys/socket.h>
+
+struct LivePoint { uint32_t t_ms; float dp, va, tc; };
+
+// App task: push and tick; attach runs in the HTTP task under AppLock
+static LivePoint ring[LIVE_RING_LEN];
+static uint32_t  head = 0;            // total points pushed
+
+struct Subscriber {
+  WiFiClient c;
+  uint32_t   next;                    // next ring sequence to put in a frame
+  uint32_t   stallMs;                 // since a short write; each whole frame resets it (0 = flowing)
+  uint16_t   len, off;                // pending frame in buf: bytes built, bytes sent
+  bool       used;
+  char       buf[LIVE_FRAME_BUF];
+};
+static_assert(LIVE_FRAME_BUF <= 0xFFFF, "frame offsets are 16-bit");
+static Subscriber subs[LIVE_MAX_CLIENTS];
+static uint32_t   lastFrameMs = 0, lastSendMs = 0;
+static uint32_t   skipped = 0;
+
+void liveStreamPush(const Sample& s){
+  ring[head % LIVE_RING_LEN] = LivePoint{ s.t_ms, s.dp_Pa, s.Va_mps, s.temp_C };
+  head++;
+}
+
+void liveStreamAttach(WebServer& server){
+  uint8_t k = 0;
+  while (k < LIVE_MAX_CLIENTS && subs[k].used) k++;
+  if (k == LIVE_MAX_CLIENTS) { server.send(503, "text/plain", "too many streams"); return; }
+
+  WiFiClient c = server.client();
+  c.setNoDelay(true);
+  c.print("HTTP/1.1 200 OK\r\n"
+          "Content-Type: text/event-stream\r\n"
+          "Cache-Control: no-cache\r\n"
+          "Connection: keep-alive\r\n"
+          "Access-Control-Allow-Origin: *\r\n\r\n"
+          "retry: 2000\n\n");
+  subs[k].c       = c;
+  subs[k].next    = head;             // live from now on
+  subs[k].stallMs = 0;
+  subs[k].len     = subs[k].off = 0;
+  subs[k].used    = true;
+}
+
+// One SSE frame with points [from, to) into frame (bounded by LIVE_FRAME_BUF)
+static size_t buildFrame(char* frame, uint32_t from, uint32_t& to){
+  const uint64_t t0 = (uint64_t)g_timeOffsetMs + ring[from % LIVE_RING_LEN].t_ms;
+  int n = snprintf(frame, LIVE_FRAME_BUF, "data: {\"t0\":%llu,\"d\":[", (unsigned long long)t0);
+  uint32_t i = from;
+  for (; i < to; i++) {
+    const LivePoint& p = ring[i % LIVE_RING_LEN];
+    // worst case ~64 B per point + ~200 B trailer
+    if ((size_t)n + 64 + 200 > LIVE_FRAME_BUF) break;
+    n += snprintf(frame + n, LIVE_FRAME_BUF - n, "%s[%lu,%.4f,%.4f,%.3f]", i == from ? "" : ",",
+                  (unsigned long)(p.t_ms - ring[from % LIVE_RING_LEN].t_ms), p.dp, p.va, p.tc);
+  }
+  to = i;
+  n += snprintf(frame + n, LIVE_FRAME_BUF - n, "]");
+  if (DP_AUX_N) {                     // latest extra ΔP readings, per frame like env
+    n += snprintf(frame + n, LIVE_FRAME_BUF - n, ",\"x\":[");
+    for (uint8_t k = 0; k < DP_AUX_N; k++) {
+      const float v = lastS.auxDp_Pa[k];
+      n += isnan(v) ? snprintf(frame + n, LIVE_FRAME_BUF - n, "%snull", k ? "," : "")
+                    : snprintf(frame + n, LIVE_FRAME_BUF - n, "%s%.4f", k ? "," : "", v);
+    }
+    n += snprintf(frame + n, LIVE_FRAME_BUF - n, "]");
+  }
+  n += snprintf(frame + n, LIVE_FRAME_BUF - n,
+                ",\"e\":[%.4f,%.1f,%.2f,%.1f,%d],\"lg\":%d,\"f\":\"%s\"}\n\n",
+                rho, isnan(envP_Pa) ? 0.0f : envP_Pa, isnan(envT_C) ? 0.0f : envT_C,
+                isnan(envRH) ? 0.0f : envRH, envHasHum ? 1 : 0, loggingOn ? 1 : 0, currentLogNameC());
+  return (size_t)n;
+}
+
+// Bytes of p the socket takes right now without waiting: 0 when its send
+// buffer is full, -1 when the connection is gone. WiFiClient::write() would
+// select() and retry for seconds on a full buffer, so send() directly.
+static int sendNow(WiFiClient& c, const char* p, size_t n){
+  const int fd = c.fd();
+  if (fd < 0) return -1;
+  const int w = ::send(fd, p, n, MSG_DONTWAIT);
+  if (w >= 0) return w;
+  return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+}
+
+void liveStreamTick(uint32_t now_ms){
+  if (now_ms - lastFrameMs < liveFrameMs) return;
+  lastFrameMs = now_ms;
+
+  const bool keepAlive = (now_ms - lastSendMs) >= 15000;
+  for (auto& s : subs) {
+    if (!s.used) continue;
+    if (!s.c.connected()) { s.c.stop(); s.used = false; continue; }
+
+    if (head - s.next > LIVE_RING_LEN) {          // lapped: resume at the oldest kept point
+      skipped += head - s.next - LIVE_RING_LEN;
+      s.next = head - LIVE_RING_LEN;
+    }
+    if (keepAlive && s.off == s.len && s.next == head) {
+      memcpy(s.buf, ": ka\n\n", 6);
+      s.len = 6; s.off = 0;
+    }
+    // Never block the app task on a socket: send what it takes, keep the rest
+    // of the frame for the next tick. A subscriber that stays behind laps the
+    // ring (counted as skipped) and is dropped once no frame has completed
+    // for LIVE_STALL_MS after a short write.
+    bool ok = true;
+    for (;;) {
+      if (s.off == s.len) {
+        if (s.next == head) break;
+        uint32_t to = head;
+        s.len  = (uint16_t)buildFrame(s.buf, s.next, to);
+        s.off  = 0;
+        s.next = to;
+      }
+      const int w = sendNow(s.c, s.buf + s.off, s.len - s.off);
+      if (w < 0) { ok = false; break; }
+      s.off += w;
+      if (s.off < s.len) break;                   // short write: send buffer full
+      s.stallMs = 0;                              // a whole frame went out
+    }
+    if (ok && s.off < s.len) {
+      if (!s.stallMs) s.stallMs = now_ms | 1;
+      else if (now_ms - s.stallMs >= LIVE_STALL_MS) ok = false;
+    }
+    if (!ok) { s.c.stop(); s.used = false; }
+  }
+  if (keepAlive) lastSendMs = now_ms;
+}
+
+uint8_t liveStreamClients(){
+  uint8_t n = 0;
+  for (auto& s : subs) n += s.used;
+  return n;
+}
+
+uint32_t liveStreamSkipped(){ return skipped; }
@@ -0,0 +1,23 @@
+#pragma once
+#include "Shared.h"
+
+class WebServer;
+
+// Push channel for the UI (Server-Sent Events on /api/stream).
+// Every processed sample is queued; each subscriber gets all of them in
+// batched frames every liveFrameMs:
+//   data: {"t0":<epoch ms>,"d":[[dt_ms,dp,va,tc],...],"e":[rho,ap,at,ah,hasH],"lg":0|1,"f":"<file>"}
+
+// App task: queue a processed sample (after lastS is published)
+void liveStreamPush(const Sample& s);
+
+// HTTP handler body for /api/stream: adopts the connection as a subscriber
+void liveStreamAttach(WebServer& server);
+
+// App task: send pending frames to subscribers, drop dead connections.
+// Never blocks: a frame the socket only partly takes is finished on later
+// ticks; a subscriber stuck on one for LIVE_STALL_MS is dropped.
+void liveStreamTick(uint32_t now_ms);
+
+uint8_t  liveStreamClients();
+uint32_t liveStreamSkipped();   // samples a slow subscriber missed (ring lapped)
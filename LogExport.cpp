@@ -0,0 +1,341 @@
+#include "LogExport.h"
+#include "Config.h"
+#include "Logging.h"
+#include "LogFormat.h"
+#include "LogIndex.h"
+#include "MS5525Comp.h"
+#include "EnvSensor.h"
+#include "Storage.h"
+#include "FlashFS.h"
+#include <WebServer.h>
+#include <WiFi.h>
+
+// Response on an adopted connection (the server has moved on): status line
+// and headers are written here, the body as HTTP/1.1 chunks
+static void sendHead(WiFiClient& c, int code, const char* type, const String& extra = String()) {
+  c.printf("HTTP/1.1 %d %s\r\nContent-Type: %s\r\n%sConnection: close\r\n",
+           code, code == 200 ? "OK" : "Error", type, extra.c_str());
+}
+static void sendError(WiFiClient& c, int code, const char* msg) {
+  sendHead(c, code, "text/plain");
+  c.printf("Content-Length: %u\r\n\r\n%s", (unsigned)strlen(msg), msg);
+}
+
+// Coalesces small writes into ~one TCP segment per HTTP chunk
+class ChunkOut {
+public:
+  explicit ChunkOut(WiFiClient& c) : c_(c) {}
+  void put(const char* p, size_t n) {
+    while (n) {
+      size_t k = min(n, sizeof(buf_) - n_);
+      memcpy(buf_ + n_, p, k);
+      n_ += k; p += k; n -= k;
+      if (n_ == sizeof(buf_)) flush();
+    }
+  }
+  void flush() {
+    if (!n_) return;
+    char h[12];
+    const int k = snprintf(h, sizeof(h), "%X\r\n", (unsigned)n_);
+    if (c_.write((const uint8_t*)h, k) != (size_t)k || c_.write((const uint8_t*)buf_, n_) != n_) lost_ = true;
+    c_.write((const uint8_t*)"\r\n", 2);
+    n_ = 0;
+  }
+  void end()   { flush(); c_.write((const uint8_t*)"0\r\n\r\n", 5); }   // zero-length chunk terminates
+  bool lost() const { return lost_ || !c_.connected(); }   // client gone: stop reading flash
+
+private:
+  WiFiClient& c_;
+  char   buf_[1436];
+  size_t n_ = 0;
+  bool   lost_ = false;
+};
+
+// Capture rows are staged (one decoded block at a time) and compensated in
+// a batch with the coefficients prepared once from the header's PROM
+constexpr size_t ADC_BATCH = 64;
+struct AdcConv {
+  Ms5525Coef k;
+  float    zero, sign;
+  int8_t   iD1, iD2, iP, iT, iRH, iA;
+  size_t   n;
+  uint64_t unix_ms[ADC_BATCH];
+  uint32_t time_ms[ADC_BATCH];
+  uint32_t D1[ADC_BATCH], D2[ADC_BATCH];
+  float    absP[ADC_BATCH], tEnv[ADC_BATCH], rh[ADC_BATCH], act[ADC_BATCH];
+  float    P[ADC_BATCH], T[ADC_BATCH];
+};
+
+struct ExportCtx {
+  ChunkOut*        out;
+  const LogSchema* schema;
+  uint64_t         from, to;
+  bool             hit;
+  AdcConv*         adc;
+  char             line[256];
+};
+
+static const char ADC_CSV_HEADER[] =
+  "unix_ms,time_ms,dp_Pa,Va_mps,P_Pa,tempP_C,tempEnv_C,absP_Pa,RH_pct,rho_kgm3,D1,D2,active\n";
+
+// Header meta → coefficients, zero and sign (query overrides win)
+static bool adcSetup(const LogSchema& s, const LogAdcOpts& o, AdcConv& a) {
+  char v[64];
+  unsigned C[8];
+  if (!s.metaGet("prom", v, sizeof(v)) ||
+      sscanf(v, "%u,%u,%u,%u,%u,%u,%u,%u", &C[0], &C[1], &C[2], &C[3], &C[4], &C[5], &C[6], &C[7]) != 8)
+    return false;
+  uint16_t prom[8];
+  for (int i = 0; i < 8; i++) prom[i] = (uint16_t)C[i];
+
+  float pscale = MS5525_P_SCALE, zero = 0; int inv = 0;
+  if (s.metaGet("pscale", v, sizeof(v))) pscale = strtof(v, nullptr);
+  if (s.metaGet("zero",   v, sizeof(v))) zero   = strtof(v, nullptr);
+  if (s.metaGet("invert", v, sizeof(v))) inv    = atoi(v);
+  if (!isnan(o.pscale)) pscale = o.pscale;
+  if (!isnan(o.zero))   zero   = o.zero;
+  if (o.invert >= 0)    inv    = o.invert;
+
+  ms5525Prepare(prom, pscale, a.k);
+  a.zero = zero;
+  a.sign = inv ? -1.0f : 1.0f;
+  a.iD1 = s.find("D1"); a.iD2 = s.find("D2");
+  a.iP  = s.find("absP_Pa"); a.iT = s.find("tempEnv_C"); a.iRH = s.find("RH_pct");
+  a.iA  = s.find("active");   // absent in captures from older firmware
+  a.n   = 0;
+  return a.iD1 >= 0 && a.iD2 >= 0;
+}
+
+static void adcFlush(ExportCtx& c) {
+  AdcConv& a = *c.adc;
+  ms5525ConvertBatch(a.k, a.D1, a.D2, a.n, a.P, a.T);
+  for (size_t i = 0; i < a.n; i++) {
+    const float dp  = a.sign * (a.P[i] - a.zero);
+    const bool  env = a.absP[i] > 0 && !isnan(a.tEnv[i]);
+    float rho = env ? envComputeRho(a.absP[i], a.tEnv[i], a.rh[i], !isnan(a.rh[i])) : NAN;
+    if (!(rho > 0.5f && rho < 2.0f)) rho = DEFAULT_RHO;
+    const float va = sqrtf(2.0f * fabsf(dp) / rho);     // ungated, no deadband
+    int n = snprintf(c.line, sizeof(c.line), "%llu,%lu,%.4f,%.4f,%.1f,%.3f,%.3f,%.1f,%.1f,%.4f,%lu,%lu,%.0f\n",
+                     (unsigned long long)a.unix_ms[i], (unsigned long)a.time_ms[i],
+                     (double)dp, (double)va, (double)a.P[i], (double)a.T[i],
+                     (double)a.tEnv[i], (double)a.absP[i], (double)a.rh[i], (double)rho,
+                     (unsigned long)a.D1[i], (unsigned long)a.D2[i], (double)a.act[i]);
+    if (n > 0 && (size_t)n < sizeof(c.line)) c.out->put(c.line, n);
+  }
+  a.n = 0;
+}
+
+static void stageAdcRow(const LogRow& r, void* p) {
+  ExportCtx& c = *(ExportCtx*)p;
+  if (r.unix_ms < c.from || r.unix_ms > c.to) return;
+  AdcConv& a = *c.adc;
+  const size_t i = a.n++;
+  a.unix_ms[i] = r.unix_ms;
+  a.time_ms[i] = r.time_ms;
+  a.D1[i]   = (uint32_t)r.v[a.iD1];
+  a.D2[i]   = (uint32_t)r.v[a.iD2];
+  a.absP[i] = a.iP  >= 0 ? r.v[a.iP]  : NAN;
+  a.tEnv[i] = a.iT  >= 0 ? r.v[a.iT]  : NAN;
+  a.rh[i]   = a.iRH >= 0 ? r.v[a.iRH] : NAN;
+  a.act[i]  = a.iA  >= 0 ? r.v[a.iA]  : NAN;
+  if (a.n == ADC_BATCH) adcFlush(c);
+}
+
+static void emitCsvRow(const LogRow& r, void* p) {
+  ExportCtx& c = *(ExportCtx*)p;
+  if (r.unix_ms < c.from || r.unix_ms > c.to) return;
+  size_t n = logFormatCsv(*c.schema, r, c.line, sizeof(c.line));
+  c.out->put(c.line, n);
+}
+
+static void markHit(const LogRow& r, void* p) {
+  ExportCtx& c = *(ExportCtx*)p;
+  if (r.unix_ms >= c.from && r.unix_ms <= c.to) c.hit = true;
+}
+
+// Byte range [a, b) of the log that can contain rows in [from, to]
+static void seekRange(const String& fn, uint32_t dataStart, uint32_t fileSize,
+                      uint64_t from, uint64_t to, uint32_t& a, uint32_t& b) {
+  a = dataStart; b = fileSize;
+  LogIndexReader ix;
+  if (!ix.open(logIndexPath(fn))) return;
+  LogIndexEntry e;
+  const uint32_t i = ix.lowerBound(from);
+  if (i < ix.count() && ix.get(i, e)) a = e.offset;
+  else if (ix.count() && ix.get(ix.count() - 1, e)) a = e.offset + e.bytes;  // only the unindexed tail
+  const uint32_t j = ix.upperBound(to);
+  if (j < ix.count() && ix.get(j, e)) b = e.offset;
+  ix.close();
+  a = min(a, fileSize); b = min(b, fileSize);   // never past the committed watermark
+  if (b < a) b = a;
+}
+
+// Per-worker buffers (too big for the task stacks)
+struct ExportBufs {
+  LogSchema schema;
+  AdcConv   adc;
+  uint8_t   blk[LOG_BLOCK_SIZE];
+  char      lines[1024];   // CSV: carry of a partial row between reads
+  size_t    have;
+};
+
+// Emit the rows in file bytes [pos, end); returns where the next read starts.
+// Binary: whole blocks only (a partial one is re-read once complete).
+static uint32_t pumpBlocks(File& f, uint32_t pos, uint32_t end, uint8_t fmt, bool convert,
+                           ExportCtx& ctx, ExportBufs& eb) {
+  f.seek(pos);
+  for (; pos + LOG_BLOCK_SIZE <= end && !ctx.out->lost(); pos += LOG_BLOCK_SIZE) {
+    if (f.read(eb.blk, LOG_BLOCK_SIZE) != LOG_BLOCK_SIZE) break;
+    if (fmt == LOG_FMT_BIN) {
+      ctx.hit = false;
+      if (logDecodeBlock(eb.blk, eb.schema, markHit, &ctx) && ctx.hit) ctx.out->put((const char*)eb.blk, LOG_BLOCK_SIZE);
+    } else if (convert) {
+      if (logDecodeBlock(eb.blk, eb.schema, stageAdcRow, &ctx)) adcFlush(ctx);
+      else eb.adc.n = 0;                                   // drop a half-decoded block
+    } else {
+      logDecodeBlock(eb.blk, eb.schema, emitCsvRow, &ctx);   // bad CRC → block skipped
+    }
+  }
+  return pos;
+}
+
+// CSV: line-filter [pos, end), copying rows whose leading unix_ms is in
+// range. All bytes are consumed; a trailing partial row stays in the carry.
+static uint32_t pumpLines(File& f, uint32_t pos, uint32_t end, ExportCtx& ctx, ExportBufs& eb) {
+  char* buf = eb.lines;
+  size_t& have = eb.have;
+  f.seek(pos);
+  while (!ctx.out->lost()) {
+    if (pos < end && have < sizeof(eb.lines)) {
+      size_t n = f.read((uint8_t*)buf + have, min<uint32_t>(sizeof(eb.lines) - have, end - pos));
+      if (!n) end = pos;
+      pos += n; have += n;
+    }
+    char* nl = (char*)memchr(buf, '\n', have);
+    if (!nl) {
+      if (have == sizeof(eb.lines)) have = 0;   // overlong line: skip it
+      else if (pos >= end) break;
+      continue;
+    }
+    const size_t len = nl - buf + 1;
+    const uint64_t t = strtoull(buf, nullptr, 10);
+    if (t >= ctx.from && t <= ctx.to) ctx.out->put(buf, len);
+    memmove(buf, buf + len, have - len);
+    have -= len;
+  }
+  return pos;
+}
+
+static void logExport(WiFiClient& client, const LogExportReq& r, ExportBufs& eb) {
+  const String&  fn = r.fn;
+  const uint64_t from_ms = r.from, to_ms = r.to;
+  const uint8_t  fmt = r.fmt;
+  File f = FLASHFS.open(fn, FILE_READ);
+  if (!f) { sendError(client, 500, "open failed"); return; }
+
+  // Header line: CSV column names or the binary schema
+  char hdr[LOG_HEADER_MAX];
+  size_t hn = f.read((uint8_t*)hdr, sizeof(hdr) - 1);
+  hdr[hn] = 0;
+  char* nl = strchr(hdr, '\n');
+  if (!nl) { f.close(); sendError(client, 500, "bad header"); return; }
+  const uint32_t dataStart = (nl - hdr) + 1;
+  *nl = 0;
+
+  const bool isAdc = fn.endsWith(".adc");
+  const bool isBin = isAdc || fn.endsWith(".bin");
+  LogSchema& schema = eb.schema;
+  AdcConv&   adc    = eb.adc;
+  if (isBin && !schema.parseBinHeader(hdr)) { f.close(); sendError(client, 500, "bad schema"); return; }
+  if (!isBin && fmt == LOG_FMT_BIN) { f.close(); sendError(client, 400, "fmt=bin needs a .bin/.adc log"); return; }
+  const bool convert = isAdc && fmt != LOG_FMT_BIN;
+  if (convert && !adcSetup(schema, r.adc, adc)) { f.close(); sendError(client, 500, "no PROM in header"); return; }
+
+  // Active segment: only up to the committed watermark (no copy, no pause)
+  uint32_t committed;
+  bool active = logCommitted(fn.c_str(), committed);
+  const uint32_t size = active ? min<uint32_t>(f.size(), committed) : f.size();
+  uint32_t a, b;
+  seekRange(fn, dataStart, size, from_ms, to_ms, a, b);
+  if (r.tail) b = size;                      // keep reading in order from here
+
+  String base = fn.substring(1);
+  int dot = base.lastIndexOf('.');
+  if (dot > 0) base = base.substring(0, dot);
+  sendHead(client, 200, fmt == LOG_FMT_BIN ? "application/octet-stream" : "text/csv",
+           "Content-Disposition: attachment; filename=\"" + base +
+           (fmt != LOG_FMT_BIN ? ".csv\"" : isAdc ? ".adc\"" : ".bin\"") + "\r\n");
+  client.print("Transfer-Encoding: chunked\r\n\r\n");
+
+  ChunkOut out(client);
+  ExportCtx ctx;
+  ctx.out = &out; ctx.schema = &schema; ctx.from = from_ms; ctx.to = to_ms; ctx.adc = &adc;
+
+  if (isBin) {
+    if (fmt == LOG_FMT_BIN) { out.put(hdr, strlen(hdr)); out.put("\n", 1); }
+    else if (convert) out.put(ADC_CSV_HEADER, sizeof(ADC_CSV_HEADER) - 1);
+    else if (size_t n = schema.csvHeader(ctx.line, sizeof(ctx.line))) { out.put(ctx.line, n); out.put("\n", 1); }
+  } else {
+    out.put(hdr, strlen(hdr)); out.put("\n", 1);
+  }
+  eb.have = 0;
+  auto pump = [&](uint32_t from, uint32_t to) {
+    return isBin ? pumpBlocks(f, from, to, fmt, convert, ctx, eb) : pumpLines(f, from, to, ctx, eb);
+  };
+  uint32_t pos = pump(a, b);
+
+  // Tail: follow the watermark until the segment is closed or the client leaves
+  if (r.tail) {
+    logTailFollow(true);
+    while (active && !out.lost()) {
+      out.flush();
+      vTaskDelay(pdMS_TO_TICKS(LOG_TAIL_POLL_MS));
+      active = logCommitted(fn.c_str(), committed);
+      f.close();
+      f = FLASHFS.open(fn, FILE_READ);       // fresh handle sees the appended data
+      if (!f) break;
+      const uint32_t end = active ? min<uint32_t>(f.size(), committed) : f.size();
+      if (end > pos) pos = pump(pos, end);
+    }
+    logTailFollow(false);
+  }
+  out.end();
+  if (f) f.close();
+}
+
+// ---- Export workers ----
+struct ExportJob {
+  WiFiClient   client;
+  LogExportReq req;
+};
+static QueueHandle_t jobs = nullptr;
+static ExportBufs    bufs[EXPORT_WORKERS];
+
+static void exportTask(void* arg) {
+  ExportBufs& eb = bufs[(uintptr_t)arg];
+  for (;;) {
+    ExportJob* j = nullptr;
+    if (xQueueReceive(jobs, &j, portMAX_DELAY) != pdTRUE || !j) continue;
+    logExport(j->client, j->req, eb);
+    j->client.stop();
+    storageUnpin(j->req.fn.c_str());
+    delete j;
+  }
+}
+
+void logExportBegin() {
+  if (jobs) return;
+  jobs = xQueueCreate(EXPORT_WORKERS, sizeof(ExportJob*));
+  for (uint8_t i = 0; i < EXPORT_WORKERS; i++)
+    xTaskCreatePinnedToCore(exportTask, "export", EXPORT_STACK, (void*)(uintptr_t)i,
+                            HTTP_PRIO, nullptr, APP_CORE);
+}
+
+bool logExportSubmit(WebServer& server, const LogExportReq& r) {
+  if (!jobs || !storagePin(r.fn.c_str())) return false;   // retention/delete keep off it
+  ExportJob* j = new ExportJob{ server.client(), r };
+  if (xQueueSend(jobs, &j, 0) == pdTRUE) return true;
+  storageUnpin(r.fn.c_str());
+  delete j;
+  return false;
+}
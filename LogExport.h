@@ -0,0 +1,38 @@
+#pragma once
+#include "Shared.h"
+#include <math.h>
+
+class WebServer;
+
+// Re-applied to capture (.adc) logs on conversion; NaN / -1 → the value
+// recorded in the file header
+struct LogAdcOpts {
+  float  zero   = NAN;   // Pa subtracted from P
+  float  pscale = NAN;   // MS5525 counts → Pa
+  int8_t invert = -1;
+};
+
+// One /download: rows of log `fn` with unix_ms in [from, to].
+// fmt: LOG_FMT_CSV (converted on the fly) or LOG_FMT_BIN (schema line +
+// whole blocks overlapping the range; .bin/.adc logs only). Capture logs are
+// compensated in batches with the header's PROM. The .idx side file is used
+// to seek to the range; without one the file is scanned. No temp copies:
+// the segment being written is read up to its committed watermark
+// (logCommitted). tail: then keep streaming rows as they are committed,
+// until the segment is closed (rotation, stop) or the client disconnects.
+struct LogExportReq {
+  String     fn;
+  uint64_t   from = 0, to = UINT64_MAX;
+  uint8_t    fmt  = 0;           // LOG_FMT_CSV
+  LogAdcOpts adc;
+  bool       tail = false;       // keep following the active segment
+};
+
+// Start the EXPORT_WORKERS tasks (httpBegin)
+void logExportBegin();
+
+// HTTP task: adopt the current connection and queue the export; a worker
+// writes the response (chunked) while the server serves other clients.
+// The file is pinned (Storage.h) until the export ends.
+// false → every worker busy and the queue full (reply 503).
+bool logExportSubmit(WebServer& server, const LogExportReq& r);
@@ -0,0 +1,224 @@
+#include "LogFormat.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ---------- schema ----------
+static uint8_t decimalsFor(uint32_t scale) {
+  uint8_t d = 0;
+  while (scale >= 10) { scale /= 10; d++; }
+  return d;
+}
+
+bool LogSchema::add(const char* name, uint32_t scale) {
+  const size_t len = strlen(name);
+  if (n >= LOG_MAX_COLS || !scale || len >= sizeof(col[0].name)) return false;   // never truncate a name
+  LogColumn &c = col[n++];
+  memcpy(c.name, name, len);
+  c.name[len] = 0;
+  c.scale    = scale;
+  c.decimals = decimalsFor(scale);
+  return true;
+}
+
+int LogSchema::find(const char* name) const {
+  for (uint8_t i = 0; i < n; i++) if (!strcmp(col[i].name, name)) return i;
+  return -1;
+}
+
+bool LogSchema::metaGet(const char* key, char* out, size_t cap) const {
+  const size_t kl = strlen(key);
+  for (const char* p = meta; *p; ) {
+    while (*p == ' ') p++;
+    const char* e = p;
+    while (*e && *e != ' ') e++;
+    if ((size_t)(e - p) > kl && p[kl] == '=' && !strncmp(p, key, kl)) {
+      const size_t vl = e - p - kl - 1;
+      if (vl + 1 > cap) return false;
+      memcpy(out, p + kl + 1, vl);
+      out[vl] = 0;
+      return true;
+    }
+    p = e;
+  }
+  return false;
+}
+
+size_t LogSchema::csvHeader(char* out, size_t cap) const {
+  int len = snprintf(out, cap, "unix_ms,time_ms");
+  for (uint8_t i = 0; i < n && len > 0 && (size_t)len < cap; i++)
+    len += snprintf(out + len, cap - len, ",%s", col[i].name);
+  return (len > 0 && (size_t)len < cap) ? (size_t)len : 0;
+}
+
+size_t LogSchema::binHeader(char* out, size_t cap) const {
+  int len = snprintf(out, cap, "#aerolog v1 fmt=bin block=%u cols=", (unsigned)LOG_BLOCK_SIZE);
+  for (uint8_t i = 0; i < n && len > 0 && (size_t)len < cap; i++)
+    len += snprintf(out + len, cap - len, "%s%s/%lu", i ? "," : "", col[i].name, (unsigned long)col[i].scale);
+  if (meta[0] && len > 0 && (size_t)len < cap) len += snprintf(out + len, cap - len, " %s", meta);
+  if (len > 0 && (size_t)len + 1 < cap) { out[len++] = '\n'; out[len] = 0; return len; }
+  return 0;
+}
+
+bool LogSchema::parseBinHeader(const char* line) {
+  n = 0; meta[0] = 0;
+  if (strncmp(line, "#aerolog v1 fmt=bin", 19) != 0) return false;
+  const char* p = strstr(line, "cols=");
+  if (!p) return false;
+  p += 5;
+  while (*p && *p != '\n' && *p != '\r' && *p != ' ') {
+    char name[16]; size_t k = 0;
+    while (*p && *p != '/' && *p != ',' && *p != '\n' && k < sizeof(name) - 1) name[k++] = *p++;
+    name[k] = 0;
+    if (*p != '/') return false;       // malformed or over-long column name
+    uint32_t scale = (uint32_t)strtoul(p + 1, (char**)&p, 10);
+    if (!add(name, scale)) return false;
+    if (*p == ',') p++;
+  }
+  if (*p == ' ') {                     // trailing metadata
+    size_t k = 0;
+    p++;
+    while (*p && *p != '\n' && *p != '\r' && k < sizeof(meta) - 1) meta[k++] = *p++;
+    meta[k] = 0;
+  }
+  return n > 0;
+}
+
+// ---------- CSV ----------
+size_t logFormatCsv(const LogSchema& s, const LogRow& r, char* out, size_t cap) {
+  int len = snprintf(out, cap, "%llu,%lu", (unsigned long long)r.unix_ms, (unsigned long)r.time_ms);
+  for (uint8_t i = 0; i < s.n && len > 0 && (size_t)len < cap; i++)
+    len += snprintf(out + len, cap - len, ",%.*f", s.col[i].decimals, (double)r.v[i]);
+  if (len > 0 && (size_t)len + 1 < cap) { out[len++] = '\n'; out[len] = 0; return len; }
+  return 0;
+}
+
+// ---------- CRC-32 (IEEE, reflected, nibble table) ----------
+uint32_t logCrc32(const uint8_t* p, size_t n, uint32_t crc) {
+  static const uint32_t T[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  crc = ~crc;
+  while (n--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ T[crc & 15];
+    crc = (crc >> 4) ^ T[crc & 15];
+  }
+  return ~crc;
+}
+
+// ---------- varint helpers ----------
+static inline uint64_t zigzag(int64_t v)   { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+static inline int64_t  unzigzag(uint64_t u){ return (int64_t)(u >> 1) ^ -(int64_t)(u & 1); }
+
+static size_t putVarint(uint8_t* p, uint64_t u) {
+  size_t n = 0;
+  while (u >= 0x80) { p[n++] = (uint8_t)u | 0x80; u >>= 7; }
+  p[n++] = (uint8_t)u;
+  return n;
+}
+
+static bool getVarint(const uint8_t*& p, const uint8_t* end, uint64_t& u) {
+  u = 0;
+  for (int shift = 0; shift < 64 && p < end; shift += 7) {
+    uint8_t b = *p++;
+    u |= (uint64_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+static inline int32_t quantize(float v, uint32_t scale) {
+  if (isnan(v)) return LOG_Q_NAN;
+  double q = (double)v * scale;
+  if (q >  2147483647.0) q =  2147483647.0;
+  if (q < -2147483647.0) q = -2147483647.0;
+  return (int32_t)lround(q);
+}
+
+static inline void put16(uint8_t* p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static inline void put32(uint8_t* p, uint32_t v) { put16(p, v); put16(p + 2, v >> 16); }
+static inline void put64(uint8_t* p, uint64_t v) { put32(p, (uint32_t)v); put32(p + 4, (uint32_t)(v >> 32)); }
+static inline uint16_t get16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static inline uint32_t get32(const uint8_t* p) { return get16(p) | ((uint32_t)get16(p + 2) << 16); }
+static inline uint64_t get64(const uint8_t* p) { return get32(p) | ((uint64_t)get32(p + 4) << 32); }
+
+// ---------- encoder ----------
+void LogBlockEncoder::begin(const LogSchema* s, uint32_t seq) {
+  s_ = s; seq_ = seq;
+  len_ = 0; rows_ = 0; t0_ = 0; prevT_ = 0; prevMs_ = 0;
+  memset(prevQ_, 0, sizeof(prevQ_));
+}
+
+bool LogBlockEncoder::add(const LogRow& r) {
+  uint8_t  tmp[10 * (LOG_MAX_COLS + 2)];
+  int32_t  q[LOG_MAX_COLS];
+  uint64_t prevT = rows_ ? prevT_ : r.unix_ms;   // row 0: delta from t0 (= 0)
+  size_t   n = 0;
+
+  n += putVarint(tmp + n, zigzag((int64_t)(r.unix_ms - prevT)));
+  n += putVarint(tmp + n, zigzag((int64_t)r.time_ms - (int64_t)prevMs_));
+  for (uint8_t i = 0; i < s_->n; i++) {
+    q[i] = quantize(r.v[i], s_->col[i].scale);
+    n += putVarint(tmp + n, zigzag((int64_t)q[i] - (int64_t)prevQ_[i]));
+  }
+  if (len_ + n > LOG_BLOCK_DATA || rows_ == 0xFFFF) return false;
+
+  memcpy(buf_ + LOG_BLOCK_HDR + len_, tmp, n);
+  len_ += n;
+  if (!rows_) t0_ = r.unix_ms;
+  rows_++;
+  prevT_ = r.unix_ms; prevMs_ = r.time_ms;
+  memcpy(prevQ_, q, sizeof(int32_t) * s_->n);
+  return true;
+}
+
+const uint8_t* LogBlockEncoder::finish() {
+  memset(buf_ + LOG_BLOCK_HDR + len_, 0, LOG_BLOCK_DATA - len_);
+  put32(buf_ + 0,  LOG_BLOCK_MAGIC);
+  put32(buf_ + 4,  seq_);
+  put16(buf_ + 8,  rows_);
+  put16(buf_ + 10, (uint16_t)len_);
+  put64(buf_ + 12, t0_);
+  put32(buf_ + LOG_BLOCK_SIZE - 4, logCrc32(buf_, LOG_BLOCK_SIZE - 4));
+  return buf_;
+}
+
+// ---------- decoder ----------
+bool logBlockInfo(const uint8_t* blk, LogBlockInfo& info) {
+  if (get32(blk) != LOG_BLOCK_MAGIC) return false;
+  if (get32(blk + LOG_BLOCK_SIZE - 4) != logCrc32(blk, LOG_BLOCK_SIZE - 4)) return false;
+  info.seq  = get32(blk + 4);
+  info.rows = get16(blk + 8);
+  info.t0   = get64(blk + 12);
+  return get16(blk + 10) <= LOG_BLOCK_DATA;
+}
+
+bool logDecodeBlock(const uint8_t* blk, const LogSchema& s, LogRowFn fn, void* ctx) {
+  LogBlockInfo info;
+  if (!logBlockInfo(blk, info)) return false;
+  const uint8_t* p   = blk + LOG_BLOCK_HDR;
+  const uint8_t* end = p + get16(blk + 10);
+
+  LogRow   r;
+  int64_t  q[LOG_MAX_COLS] = {0};
+  uint64_t t  = info.t0;
+  int64_t  ms = 0;
+  for (uint16_t k = 0; k < info.rows; k++) {
+    uint64_t u;
+    if (!getVarint(p, end, u)) return false;
+    t += (uint64_t)unzigzag(u);
+    if (!getVarint(p, end, u)) return false;
+    ms += unzigzag(u);
+    r.unix_ms = t;
+    r.time_ms = (uint32_t)ms;
+    for (uint8_t i = 0; i < s.n; i++) {
+      if (!getVarint(p, end, u)) return false;
+      q[i] += unzigzag(u);
+      r.v[i] = (q[i] == LOG_Q_NAN) ? NAN : (float)((double)q[i] / s.col[i].scale);
+    }
+    if (fn) fn(r, ctx);
+  }
+  return true;
+}
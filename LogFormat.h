@@ -0,0 +1,102 @@
+#pragma once
+// Binary block log format ("ALB1") + shared row/schema helpers.
+// No Arduino dependencies: the same code encodes on the device and decodes
+// for download/analysis (and builds on the host).
+//
+// File layout
+//   line 1 : self-describing schema, e.g.
+//            "#aerolog v1 fmt=bin block=512 cols=dp_Pa/10000,Va_mps/10000,...\n"
+//            (each float column is stored as round(value * scale))
+//            optionally followed by " key=value ..." metadata (capture logs
+//            carry the PROM and the zero/scale/invert in effect)
+//   then   : fixed-size LOG_BLOCK_SIZE blocks
+//
+// Block layout (little-endian)
+//   u32 magic 'ALB1' | u32 seq | u16 rows | u16 payload_len | u64 t0 (unix_ms of row 0)
+//   payload: per row, per column: zigzag varint of the delta to the previous row
+//            (unix_ms, time_ms, then every schema column; first row deltas from t0/0)
+//   zero padding | u32 CRC-32 over everything before it
+#include <stddef.h>
+#include <stdint.h>
+
+constexpr size_t   LOG_BLOCK_SIZE   = 512;
+constexpr size_t   LOG_BLOCK_HDR    = 20;
+constexpr size_t   LOG_BLOCK_DATA   = LOG_BLOCK_SIZE - LOG_BLOCK_HDR - 4;
+constexpr uint32_t LOG_BLOCK_MAGIC  = 0x31424C41;   // "ALB1"
+constexpr uint8_t  LOG_MAX_COLS     = 24;
+constexpr size_t   LOG_HEADER_MAX   = 512;
+constexpr size_t   LOG_META_MAX     = 160;
+constexpr int32_t  LOG_Q_NAN        = INT32_MIN;    // quantized NaN marker
+
+struct LogColumn {
+  char     name[16];
+  uint32_t scale;      // stored integer = round(value * scale)
+  uint8_t  decimals;   // CSV precision (derived from scale)
+};
+
+struct LogSchema {
+  uint8_t   n = 0;
+  LogColumn col[LOG_MAX_COLS];
+  char      meta[LOG_META_MAX] = "";   // "key=value key=value" (no spaces in values)
+
+  bool add(const char* name, uint32_t scale);   // false if full, scale 0 or name too long
+  int  find(const char* name) const;
+
+  // Value of one meta key; false if absent or it doesn't fit in cap
+  bool metaGet(const char* key, char* out, size_t cap) const;
+
+  // "unix_ms,time_ms,<col>,..." (no newline)
+  size_t csvHeader(char* out, size_t cap) const;
+  // "#aerolog v1 fmt=bin block=512 cols=<name>/<scale>,...[ <meta>]\n"
+  size_t binHeader(char* out, size_t cap) const;
+  // Parse a binHeader() line (with or without the trailing newline)
+  bool   parseBinHeader(const char* line);
+};
+
+struct LogRow {
+  uint64_t unix_ms;
+  uint32_t time_ms;
+  float    v[LOG_MAX_COLS];
+};
+
+// One CSV line for row (with trailing '\n'); returns length (0 if it won't fit)
+size_t logFormatCsv(const LogSchema& s, const LogRow& r, char* out, size_t cap);
+
+uint32_t logCrc32(const uint8_t* p, size_t n, uint32_t crc = 0);
+
+class LogBlockEncoder {
+public:
+  void   begin(const LogSchema* s, uint32_t seq);
+  // false → block is full; finish() it, begin() the next and add again
+  bool   add(const LogRow& r);
+  // Pads, writes header + CRC and returns LOG_BLOCK_SIZE bytes
+  const uint8_t* finish();
+  uint16_t rows() const { return rows_; }
+  uint32_t seq()  const { return seq_; }
+  uint64_t t0()   const { return t0_; }
+  uint64_t t1()   const { return prevT_; }   // unix_ms of the last row added
+
+private:
+  const LogSchema* s_ = nullptr;
+  uint8_t  buf_[LOG_BLOCK_SIZE];
+  size_t   len_ = 0;
+  uint16_t rows_ = 0;
+  uint32_t seq_ = 0;
+  uint64_t t0_ = 0;
+  uint64_t prevT_ = 0;
+  uint32_t prevMs_ = 0;
+  int32_t  prevQ_[LOG_MAX_COLS];
+};
+
+struct LogBlockInfo {
+  uint32_t seq;
+  uint16_t rows;
+  uint64_t t0;
+};
+
+// Validate magic + CRC and return the block header
+bool logBlockInfo(const uint8_t* blk, LogBlockInfo& info);
+
+// Decode every row of a validated block; fn is called once per row.
+typedef void (*LogRowFn)(const LogRow& r, void* ctx);
+bool logDecodeBlock(const uint8_t* blk, const LogSchema& s, LogRowFn fn, void* ctx);
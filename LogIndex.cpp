@@ -0,0 +1,143 @@
+#include "LogIndex.h"
+#include "Config.h"
+#include "FlashFS.h"
+
+constexpr size_t IDX_HDR = 8;   // u32 magic, u32 entry size
+
+const char* const LOG_IDX_COLS[LOG_IDX_CH] = { "dp_Pa", "Va_mps", "rho_kgm3" };
+
+String logIndexPath(const String& logPath){
+  int dot = -1;
+  for (int i = (int)logPath.length() - 1; i >= 0; i--) {
+    if (logPath.charAt(i) == '.') { dot = i; break; }
+    if (logPath.charAt(i) == '/') break;
+  }
+  return (dot < 0 ? logPath : logPath.substring(0, dot)) + ".idx";
+}
+
+// ---------- writer ----------
+bool LogIndexWriter::open(const String& idxPath){
+  close();
+  f_ = FLASHFS.open(idxPath, FILE_WRITE);
+  if (!f_) return false;
+  const uint32_t hdr[2] = { LOG_INDEX_MAGIC, (uint32_t)sizeof(LogIndexEntry) };
+  f_.write((const uint8_t*)hdr, sizeof(hdr));
+  spanOpen_ = false;
+  nPend_ = 0;
+  return true;
+}
+
+// Entries still pending point past the data that reached flash: dropped
+void LogIndexWriter::close(){
+  if (!f_) return;
+  f_.close();
+  spanOpen_ = false;
+  nPend_ = 0;
+}
+
+void LogIndexWriter::row(uint64_t unix_ms, uint32_t offset, uint32_t bytes, const float ch[LOG_IDX_CH]){
+  if (!spanOpen_) {
+    cur_ = LogIndexEntry{ unix_ms, unix_ms, offset, 0, 0 };
+    for (LogIndexAgg& a : cur_.agg) a.reset();
+    spanOpen_ = true;
+  }
+  cur_.t1 = unix_ms;
+  cur_.bytes += bytes;
+  cur_.rows++;
+  for (uint8_t k = 0; k < LOG_IDX_CH; k++) cur_.agg[k].add(ch[k]);
+  if (cur_.bytes >= LOG_INDEX_SPAN) closeSpan();
+}
+
+void LogIndexWriter::add(const LogIndexEntry& e){
+  closeSpan();
+  push(e);
+}
+
+void LogIndexWriter::closeSpan(){
+  if (!spanOpen_) return;
+  spanOpen_ = false;
+  push(cur_);
+}
+
+// Spans are contiguous in the log, so merging into the last one keeps the
+// index complete when the data couldn't be flushed in time (FS full)
+void LogIndexWriter::push(const LogIndexEntry& e){
+  if (!f_) return;                              // no index file (FS full at open)
+  if (nPend_ < LOG_INDEX_PENDING) { pend_[nPend_++] = e; return; }
+  LogIndexEntry& l = pend_[nPend_ - 1];
+  l.t1    = e.t1;
+  l.bytes = e.offset + e.bytes - l.offset;
+  l.rows += e.rows;
+  for (uint8_t k = 0; k < LOG_IDX_CH; k++) {
+    l.agg[k].min = fminf(l.agg[k].min, e.agg[k].min);
+    l.agg[k].max = fmaxf(l.agg[k].max, e.agg[k].max);
+    l.agg[k].sum += e.agg[k].sum;
+    l.agg[k].n   += e.agg[k].n;
+  }
+}
+
+void LogIndexWriter::flush(uint32_t committed){
+  if (!f_) return;
+  uint8_t k = 0;
+  while (k < nPend_ && pend_[k].offset + pend_[k].bytes <= committed) k++;
+  if (!k) return;
+  f_.write((const uint8_t*)pend_, k * sizeof(LogIndexEntry));
+  f_.flush();
+  memmove(pend_, pend_ + k, (nPend_ - k) * sizeof(LogIndexEntry));
+  nPend_ -= k;
+}
+
+// ---------- reader ----------
+bool LogIndexReader::open(const String& idxPath){
+  n_ = 0;
+  if (!FLASHFS.exists(idxPath)) return false;
+  f_ = FLASHFS.open(idxPath, FILE_READ);
+  if (!f_) return false;
+  uint32_t hdr[2];
+  if (f_.read((uint8_t*)hdr, sizeof(hdr)) != sizeof(hdr) ||
+      hdr[0] != LOG_INDEX_MAGIC || hdr[1] != sizeof(LogIndexEntry)) { f_.close(); return false; }
+  n_ = (f_.size() - IDX_HDR) / sizeof(LogIndexEntry);
+  return true;
+}
+
+bool LogIndexReader::get(uint32_t i, LogIndexEntry& e){
+  if (i >= n_ || !f_.seek(IDX_HDR + i * sizeof(LogIndexEntry))) return false;
+  return f_.read((uint8_t*)&e, sizeof(e)) == sizeof(e);
+}
+
+uint32_t LogIndexReader::lowerBound(uint64_t t){
+  uint32_t lo = 0, hi = n_;
+  LogIndexEntry e;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (!get(mid, e)) return n_;
+    if (e.t1 < t) lo = mid + 1; else hi = mid;
+  }
+  return lo;
+}
+
+uint32_t LogIndexReader::upperBound(uint64_t t){
+  uint32_t lo = 0, hi = n_;
+  LogIndexEntry e;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (!get(mid, e)) return n_;
+    if (e.t0 <= t) lo = mid + 1; else hi = mid;
+  }
+  return lo;
+}
+
+bool LogIndexReader::summary(uint64_t& t0, uint64_t& t1, uint32_t& rows){
+  rows = 0;
+  if (!n_ || !f_.seek(IDX_HDR)) return false;
+  LogIndexEntry e[8];
+  for (uint32_t i = 0; i < n_; ) {
+    const uint32_t k = min<uint32_t>(8, n_ - i);
+    if (f_.read((uint8_t*)e, k * sizeof(LogIndexEntry)) != k * sizeof(LogIndexEntry)) return false;
+    if (i == 0) t0 = e[0].t0;
+    for (uint32_t m = 0; m < k; m++) rows += e[m].rows;
+    t1 = e[k - 1].t1;
+    i += k;
+  }
+  return true;
+}
@@ -0,0 +1,81 @@
+#pragma once
+// Per-file sparse block index ("<log>.idx" next to "<log>.csv|.bin").
+// One fixed-size entry per binary block, or per ~LOG_INDEX_SPAN bytes of CSV,
+// so readers can seek to a time range without scanning the whole log, and
+// aggregate queries (/api/query) can answer whole spans from min/max/sum.
+#include "Shared.h"
+#include "Config.h"
+#include <FS.h>
+#include <math.h>
+
+constexpr uint32_t LOG_INDEX_MAGIC = 0x32494C41;   // "ALI2" (v1 had no aggregates)
+
+// Channels summarised per span (columns of the same name; absent → n = 0)
+constexpr uint8_t LOG_IDX_CH = 3;
+extern const char* const LOG_IDX_COLS[LOG_IDX_CH];   // dp_Pa, Va_mps, rho_kgm3
+
+struct LogIndexAgg {
+  float    min, max, sum;
+  uint32_t n;          // non-NaN values
+  void reset() { min = INFINITY; max = -INFINITY; sum = 0; n = 0; }
+  void add(float v) {
+    if (isnan(v)) return;
+    min = fminf(min, v); max = fmaxf(max, v); sum += v; n++;
+  }
+};
+
+struct LogIndexEntry {
+  uint64_t t0, t1;     // unix_ms of the first / last row in the span
+  uint32_t offset;     // file offset of the span (block or first CSV row)
+  uint32_t bytes;      // span length in the log file
+  uint32_t rows;
+  LogIndexAgg agg[LOG_IDX_CH];
+};
+
+// "/log_1_2.bin" → "/log_1_2.idx"
+String logIndexPath(const String& logPath);
+
+class LogIndexWriter {
+public:
+  bool open(const String& idxPath);                  // create/truncate
+  void close();
+  // CSV: grow the open span by one row; closes it at LOG_INDEX_SPAN bytes.
+  // ch: the row's LOG_IDX_COLS values (NaN = absent)
+  void row(uint64_t unix_ms, uint32_t offset, uint32_t bytes, const float ch[LOG_IDX_CH]);
+  // Binary: one complete span per block
+  void add(const LogIndexEntry& e);
+  void closeSpan();
+  // Entries are never written on their own: the log writer flushes its
+  // data first, then hands over the committed length. Entries ending past
+  // it stay pending; a full queue grows its last entry (coarser, still exact).
+  void flush(uint32_t committed);
+  bool full() const { return nPend_ + 2 > LOG_INDEX_PENDING; }   // a call may queue two
+
+private:
+  void push(const LogIndexEntry& e);
+
+  File          f_;
+  LogIndexEntry cur_;
+  bool          spanOpen_ = false;
+  LogIndexEntry pend_[LOG_INDEX_PENDING];
+  uint8_t       nPend_ = 0;
+};
+
+// Read-side helper over an open .idx file (entries sorted by time)
+class LogIndexReader {
+public:
+  bool     open(const String& idxPath);
+  uint32_t count() const { return n_; }
+  bool     get(uint32_t i, LogIndexEntry& e);
+  // first entry whose t1 >= t (count() if none)
+  uint32_t lowerBound(uint64_t t);
+  // first entry whose t0 > t (count() if none)
+  uint32_t upperBound(uint64_t t);
+  // Time span and row total over all entries (one sequential pass)
+  bool     summary(uint64_t& t0, uint64_t& t1, uint32_t& rows);
+  void     close() { if (f_) f_.close(); }
+
+private:
+  File     f_;
+  uint32_t n_ = 0;
+};
@@ -0,0 +1,133 @@
+#include "LogQuery.h"
+#include "Logging.h"
+#include "LogFormat.h"
+#include "FlashFS.h"
+
+struct Scan {
+  LogQueryResult* q;
+  uint64_t        from, to;
+  int8_t          col[LOG_IDX_CH];   // LogRow.v index of each channel (-1: none)
+};
+
+static void addValue(LogQueryCh& c, float v){
+  if (isnan(v)) return;
+  c.min = fminf(c.min, v); c.max = fmaxf(c.max, v); c.sum += v; c.n++;
+}
+
+static void scanRow(const LogRow& r, void* p){
+  Scan& s = *(Scan*)p;
+  if (r.unix_ms < s.from || r.unix_ms > s.to) return;
+  s.q->rows++;
+  for (uint8_t k = 0; k < LOG_IDX_CH; k++)
+    if (s.col[k] >= 0) addValue(s.q->ch[k], r.v[s.col[k]]);
+}
+
+// "unix_ms,time_ms,v0,v1,…" → LogRow (empty field → NaN)
+static void parseCsvRow(const char* p, LogRow& r){
+  char* e;
+  r.unix_ms = strtoull(p, &e, 10);
+  for (uint8_t i = 0; i < LOG_MAX_COLS; i++) r.v[i] = NAN;
+  for (int f = 1; *e == ','; f++) {
+    p = e + 1;
+    const float v  = strtof(p, &e);
+    const bool  ok = e != p;
+    if (!ok) while (*e && *e != ',') e++;              // empty / unparsable
+    if (f >= 2 && f - 2 < LOG_MAX_COLS) r.v[f - 2] = ok ? v : NAN;
+  }
+}
+
+// HTTP task only
+static uint8_t blk[LOG_BLOCK_SIZE];
+static char    lines[1024];
+
+// Decode the rows in file bytes [a, b)
+static void scanBytes(File& f, bool isBin, const LogSchema& schema, uint32_t a, uint32_t b, Scan& s){
+  f.seek(a);
+  if (isBin) {
+    for (uint32_t pos = a; pos + LOG_BLOCK_SIZE <= b; pos += LOG_BLOCK_SIZE) {
+      if (f.read(blk, LOG_BLOCK_SIZE) != LOG_BLOCK_SIZE) break;
+      logDecodeBlock(blk, schema, scanRow, &s);      // bad CRC → block skipped
+    }
+    return;
+  }
+  size_t have = 0;
+  for (uint32_t pos = a; pos < b || have; ) {
+    if (pos < b && have < sizeof(lines) - 1) {
+      size_t n = f.read((uint8_t*)lines + have, min<uint32_t>(sizeof(lines) - 1 - have, b - pos));
+      if (!n) b = pos;
+      pos += n; have += n;
+    }
+    char* nl = (char*)memchr(lines, '\n', have);
+    if (!nl) { if (pos >= b || have == sizeof(lines) - 1) break; continue; }
+    *nl = 0;
+    LogRow r;
+    parseCsvRow(lines, r);
+    scanRow(r, &s);
+    const size_t len = nl - lines + 1;
+    memmove(lines, lines + len, have - len);
+    have -= len;
+  }
+}
+
+bool logQuery(const String& fn, uint64_t from_ms, uint64_t to_ms, LogQueryResult& q){
+  q = {};
+  for (LogQueryCh& c : q.ch) { c.min = INFINITY; c.max = -INFINITY; }
+
+  File f = FLASHFS.open(fn, FILE_READ);
+  if (!f) return false;
+  char hdr[LOG_HEADER_MAX];
+  size_t hn = f.read((uint8_t*)hdr, sizeof(hdr) - 1);
+  hdr[hn] = 0;
+  char* nl = strchr(hdr, '\n');
+  if (!nl) { f.close(); return false; }
+  const uint32_t dataStart = (nl - hdr) + 1;
+  *nl = 0;
+
+  // Channel columns: schema (binary) or header names (CSV, after unix_ms,time_ms)
+  const bool isBin = fn.endsWith(".bin") || fn.endsWith(".adc");
+  static LogSchema schema;   // HTTP task only
+  Scan s{ &q, from_ms, to_ms, { -1, -1, -1 } };
+  if (isBin) {
+    if (!schema.parseBinHeader(hdr)) { f.close(); return false; }
+    for (uint8_t k = 0; k < LOG_IDX_CH; k++) s.col[k] = schema.find(LOG_IDX_COLS[k]);
+  } else {
+    int field = 0;
+    for (char* t = strtok(hdr, ",\r"); t; t = strtok(nullptr, ",\r"), field++)
+      for (uint8_t k = 0; k < LOG_IDX_CH; k++)
+        if (field >= 2 && !strcmp(t, LOG_IDX_COLS[k])) s.col[k] = field - 2;
+  }
+
+  uint32_t committed;
+  const uint32_t size = logCommitted(fn.c_str(), committed) ? min<uint32_t>(f.size(), committed) : f.size();
+
+  // Whole spans from the index, edge spans decoded
+  uint32_t tail = dataStart;
+  LogIndexReader ix;
+  if (ix.open(logIndexPath(fn))) {
+    LogIndexEntry e;
+    bool stopped = false;
+    const uint32_t j = ix.upperBound(to_ms);
+    for (uint32_t i = ix.lowerBound(from_ms); i < j && ix.get(i, e); i++) {
+      if (e.offset + e.bytes > size) { tail = e.offset; stopped = true; break; }   // past the watermark
+      if (e.t0 >= from_ms && e.t1 <= to_ms) {
+        q.rows += e.rows;
+        q.spans++;
+        for (uint8_t k = 0; k < LOG_IDX_CH; k++) {
+          const LogIndexAgg& a = e.agg[k];
+          if (!a.n) continue;
+          LogQueryCh& c = q.ch[k];
+          c.min = fminf(c.min, a.min); c.max = fmaxf(c.max, a.max); c.sum += a.sum; c.n += a.n;
+        }
+      } else {
+        scanBytes(f, isBin, schema, e.offset, e.offset + e.bytes, s);
+        q.scanned++;
+      }
+    }
+    if (!stopped && ix.count() && ix.get(ix.count() - 1, e)) tail = e.offset + e.bytes;
+    ix.close();
+  }
+  // Rows not indexed yet (open span/block), or the whole file without an index
+  if (tail < size) { scanBytes(f, isBin, schema, tail, size, s); q.scanned++; }
+  f.close();
+  return true;
+}
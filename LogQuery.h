@@ -0,0 +1,24 @@
+#pragma once
+#include "Shared.h"
+#include "LogIndex.h"
+
+// Aggregates of dp_Pa, Va_mps and rho_kgm3 (LOG_IDX_COLS) over the rows of a
+// log with unix_ms in [from, to], answered from the .idx side file: spans
+// entirely inside the range are merged from their min/max/sum; only spans
+// straddling an edge and the not-yet-indexed tail are read from the log.
+// Without an index the whole file is scanned. The segment being written is
+// read up to its committed watermark. HTTP task (no AppLock needed).
+struct LogQueryCh {
+  float    min, max;
+  double   sum;
+  uint32_t n;          // non-NaN values
+};
+struct LogQueryResult {
+  uint32_t   rows;     // rows in range
+  uint32_t   spans;    // index spans used as-is
+  uint32_t   scanned;  // spans (or tail) decoded from the log
+  LogQueryCh ch[LOG_IDX_CH];
+};
+
+// false: missing/unreadable file or header
+bool logQuery(const String& fn, uint64_t from_ms, uint64_t to_ms, LogQueryResult& q);
@@ -1,65 +1,365 @@
 #include "Logging.h"
 #include "Config.h"
 #include "Shared.h"
-#include <SPIFFS.h>
+#include "LogFormat.h"
+#include "LogIndex.h"
+#include "JsonWriter.h"
+#include "SensorMS5525.h"
+#include "Storage.h"
+#include "FlashFS.h"
 #include <WebServer.h>
+#include <atomic>
 
 static File   logFile;
 static String curName;
 
+// Rows are encoded into a preallocated RAM write buffer (CSV text or whole
+// binary blocks) and reach flash in LOG_WRITE_CHUNK pieces from logTick() —
+// never per row. If flash falls behind and the buffer fills, rows are dropped
+// and counted instead of stalling the caller.
+static LogSchema       schema1Hz;       // 1 Hz rows: channels + ΔP bin statistics
+static LogSchema       schemaRaw;       // raw rows: channels only
+static LogSchema       schemaAdc;       // capture rows: D1/D2 words + env
+static const LogSchema* schema = &schema1Hz;
+static bool            rawMode = false; // latched at startLogging()
+static uint8_t         fileFmt = LOG_FMT_CSV;
+static LogBlockEncoder enc;
+static uint32_t        blockSeq = 0;
+static uint8_t         wbuf[LOG_WBUF_SIZE];
+static size_t          wHead = 0, wTail = 0;   // byte ring: append at head, drain from tail
+static uint32_t        lastFlushMs = 0, lastSyncMs = 0;
+static uint32_t        rowsWritten = 0, rowsDropped = 0;
+static uint32_t        hdrLen = 0;             // file offset of the first row/block
+static LogIndexWriter  idx;
+static int8_t          idxCol[LOG_IDX_CH];     // schema column of each LOG_IDX_COLS (-1: none)
+static LogIndexAgg     blkAgg[LOG_IDX_CH];     // rows of the open binary block
+static uint32_t        lastRawMs = 0;
+static bool            rawStarted = false;
+// Segment rotation (Storage.h): the session continues in a new file
+static size_t          segLimit = LOG_SEG_BYTES;
+static uint32_t        segStartMs = 0, lastOpenTryMs = 0;
+static uint32_t        segments = 0;
+// Watermark for concurrent readers (export workers): name + committed bytes
+static portMUX_TYPE    wmMux = portMUX_INITIALIZER_UNLOCKED;
+static char            wmName[48] = "";
+static uint32_t        wmLen = 0;
+static std::atomic<int> tailFollowers{0};
+
+// logTick() runs in the app task without AppLock (flushes must not hold up
+// the HTTP handlers); start/stop and the session name are also reached from
+// handlers, so file and segment state is guarded by this lock instead
+static SemaphoreHandle_t lock = nullptr;
+struct LockGuard {
+  LockGuard()  { if (lock) xSemaphoreTake(lock, portMAX_DELAY); }
+  ~LockGuard() { if (lock) xSemaphoreGive(lock); }
+};
+
+void logBegin(){ if (!lock) lock = xSemaphoreCreateMutex(); }
+
+static void setWatermark(const char* name, uint32_t len){
+  char n[sizeof(wmName)];
+  if (name) snprintf(n, sizeof(n), "%s", name);
+  portENTER_CRITICAL(&wmMux);
+  if (name) memcpy(wmName, n, sizeof(wmName));
+  wmLen = len;
+  portEXIT_CRITICAL(&wmMux);
+}
+
+bool logCommitted(const char* fn, uint32_t& len){
+  portENTER_CRITICAL(&wmMux);
+  const bool active = wmName[0] && !strcmp(fn, wmName);
+  len = wmLen;
+  portEXIT_CRITICAL(&wmMux);
+  return active;
+}
+
+void logTailFollow(bool on){ tailFollowers += on ? 1 : -1; }
+
+static bool blocks(){ return fileFmt != LOG_FMT_CSV; }
+
+static size_t wUsed(){ return wHead - wTail; }
+static size_t wFree(){ return LOG_WBUF_SIZE - wUsed(); }
+
+static void wPut(const uint8_t* p, size_t n){
+  while (n--) wbuf[(wHead++) % LOG_WBUF_SIZE] = *p++;
+}
+
+// Write up to `limit` buffered bytes (contiguous pieces) to the file
+static void wDrain(size_t limit){
+  while (wUsed() && limit) {
+    const size_t off = wTail % LOG_WBUF_SIZE;
+    size_t n = min(min(wUsed(), LOG_WBUF_SIZE - off), limit);
+    size_t w = logFile.write(wbuf + off, n);
+    if (w == 0) { storageSqueeze(); return; } // FS full: retention frees space, retry next tick
+    wTail += w; limit -= w;
+  }
+}
+
+static void addChannels(LogSchema& s){
+  // scale = 10^decimals of the historic CSV columns → binary is lossless vs CSV
+  s.add("dp_Pa",     10000);
+  s.add("Va_mps",    10000);
+  s.add("tempP_C",   1000);
+  s.add("tempEnv_C", 1000);
+  s.add("absP_Pa",   10);
+  s.add("RH_pct",    10);
+  s.add("rho_kgm3",  10000);
+  // extra ΔP sensors: one column each, after the primary channels
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    char name[16];
+    snprintf(name, sizeof(name), "dp%u_Pa", i + 1);
+    s.add(name, 10000);
+  }
+}
+
+static void initSchema(){
+  if (schemaRaw.n) return;
+  addChannels(schemaRaw);
+  addChannels(schema1Hz);
+  schema1Hz.add("dp_min_Pa", 10000);
+  schema1Hz.add("dp_max_Pa", 10000);
+  schema1Hz.add("dp_std_Pa", 10000);
+  schema1Hz.add("dp_p05_Pa", 10000);
+  schema1Hz.add("dp_p95_Pa", 10000);
+  // adaptive rate: 1 = full rate (raw rows), share of full-rate samples (1 Hz)
+  schemaRaw.add("active",    100);
+  schema1Hz.add("active",    100);
+  schemaAdc.add("D1",        1);        // 24-bit words: exact in a float
+  schemaAdc.add("D2",        1);
+  schemaAdc.add("absP_Pa",   10);
+  schemaAdc.add("tempEnv_C", 1000);
+  schemaAdc.add("RH_pct",    10);
+  schemaAdc.add("active",    1);
+}
+
+// Everything needed to redo the conversion offline (zero/scale/invert are
+// only the values in effect at start — export may override them)
+static void setAdcMeta(){
+  uint16_t C[8]; sensorProm(C);
+  snprintf(schemaAdc.meta, sizeof(schemaAdc.meta),
+           "prom=%u,%u,%u,%u,%u,%u,%u,%u pscale=%g zero=%.4f invert=%d osr=%u,%u",
+           C[0], C[1], C[2], C[3], C[4], C[5], C[6], C[7], (double)MS5525_P_SCALE,
+           (double)dp_zero, invertDP ? 1 : 0,
+           sensorOsrRatio(sensorOsrP()), sensorOsrRatio(sensorOsrT()));
+}
+
 static String makeNewLogName(){
   char buf[48];
-  snprintf(buf, sizeof(buf), "/log_%lu_%lu.csv",
-           (unsigned long)bootCounter, (unsigned long)millis());
+  snprintf(buf, sizeof(buf), "/log_%lu_%lu.%s",
+           (unsigned long)bootCounter, (unsigned long)millis(),
+           fileFmt == LOG_FMT_ADC ? "adc" : fileFmt == LOG_FMT_BIN ? "bin" : "csv");
   return String(buf);
 }
 
-bool logFileOpen(){ return (bool)logFile; }
+// Close the open binary block into the write buffer (padded: files always
+// end on a block boundary). Returns false if there was no room.
+static bool closeBlock(){
+  if (!enc.rows()) return true;
+  if (wFree() < LOG_BLOCK_SIZE) return false;
+  LogIndexEntry e{ enc.t0(), enc.t1(), (uint32_t)(hdrLen + wHead), (uint32_t)LOG_BLOCK_SIZE, enc.rows() };
+  memcpy(e.agg, blkAgg, sizeof(blkAgg));
+  for (LogIndexAgg& a : blkAgg) a.reset();
+  idx.add(e);
+  wPut(enc.finish(), LOG_BLOCK_SIZE);
+  rowsWritten += enc.rows();
+  enc.begin(schema, ++blockSeq);
+  return true;
+}
 
-void startLogging(){
-  if (loggingOn) return;
+// Buffered bytes → flash, then the index entries that point into them
+static void syncData(){
+  wDrain(LOG_WBUF_SIZE);
+  logFile.flush();
+  const uint32_t committed = hdrLen + wTail;
+  idx.flush(committed);        // index only ever points at data that reached flash
+  setWatermark(nullptr, committed);   // readers skip a partial trailing block/row
+}
+
+// Push everything buffered to flash and sync
+static void flushBuffers(){
+  if (!logFile) return;
+  if (blocks()) closeBlock();
+  syncData();
+}
 
+// The row's values of the index channels (dp, Va, ρ; NaN where absent)
+static void idxValues(const LogRow& r, float ch[LOG_IDX_CH]){
+  for (uint8_t k = 0; k < LOG_IDX_CH; k++) ch[k] = idxCol[k] >= 0 ? r.v[idxCol[k]] : NAN;
+}
+
+static void appendRow(const LogRow& r){
+  if (!logFile) { rowsDropped++; return; }    // between segments (open failed, retrying)
+  float ch[LOG_IDX_CH];
+  idxValues(r, ch);
+  if (blocks()) {
+    if (!enc.add(r)) {
+      // block full → queue it, start the next
+      if (!closeBlock()) {
+        rowsDropped++;
+        return;
+      }
+      enc.add(r);
+    }
+    for (uint8_t k = 0; k < LOG_IDX_CH; k++) blkAgg[k].add(ch[k]);
+    return;
+  }
+  char line[256];
+  size_t n = logFormatCsv(*schema, r, line, sizeof(line));
+  if (!n || n > wFree()) { rowsDropped++; return; }
+  idx.row(r.unix_ms, (uint32_t)(hdrLen + wHead), n, ch);
+  wPut((const uint8_t*)line, n);
+  rowsWritten++;
+}
+
+bool logFileOpen(){ return (bool)logFile; }
+bool logRawMode(){ return rawMode; }
+
+// Open the next segment: make room for a whole one first (reservation),
+// then header + index. Buffers start empty (the previous segment was flushed).
+static bool openSegment(){
+  segLimit = storageSegmentBytes();
+  storageMakeRoom(segLimit);
+  if (fileFmt == LOG_FMT_ADC) setAdcMeta();   // zero may have changed since the last segment
   curName = makeNewLogName();
 
   // Create/truncate a NEW file so header is first
-  logFile = SPIFFS.open(curName, FILE_WRITE);
+  logFile = FLASHFS.open(curName, FILE_WRITE);
   if (!logFile) {
     // fallback single filename; also truncate so header is first
-    curName = "/current.csv";
-    logFile = SPIFFS.open(curName, FILE_WRITE);
+    curName = fileFmt == LOG_FMT_ADC ? "/current.adc" : fileFmt == LOG_FMT_BIN ? "/current.bin" : "/current.csv";
+    logFile = FLASHFS.open(curName, FILE_WRITE);
   }
-  if (!logFile) { curName=""; loggingOn=false; return; }
+  if (!logFile) { storageSqueeze(); return false; }
 
-  // Always write header for a new file
-  logFile.println("unix_ms,time_ms,dp_Pa,Va_mps,tempP_C,tempEnv_C,absP_Pa,RH_pct,rho_kgm3");
+  // Always write header for a new file: column names (CSV) or the
+  // self-describing schema line (binary)
+  char hdr[LOG_HEADER_MAX];
+  if (blocks()) logFile.print(schema->binHeader(hdr, sizeof(hdr)) ? hdr : "");
+  else if (schema->csvHeader(hdr, sizeof(hdr))) logFile.println(hdr);
   logFile.flush();
+  hdrLen = logFile.position();
+  setWatermark(curName.c_str(), hdrLen);
+
+  if (!idx.open(logIndexPath(curName)))
+    Serial.println("[logging] no index (FS full?) — exports will scan");
+
+  blockSeq = 0;
+  enc.begin(schema, blockSeq);
+  for (uint8_t k = 0; k < LOG_IDX_CH; k++) { idxCol[k] = schema->find(LOG_IDX_COLS[k]); blkAgg[k].reset(); }
+  wHead = wTail = 0;
+  segStartMs = millis();
+  segments++;
+  Serial.printf("[logging] segment %lu: %s\n", (unsigned long)segments, curName.c_str());
+  return true;
+}
+
+static void closeSegment(){
+  if (logFile) { idx.closeSpan(); flushBuffers(); logFile.close(); }
+  idx.close();
+  setWatermark("", 0);   // readers now see a closed file: read to its size
+}
+
+void startLogging(){
+  LockGuard g;
+  if (loggingOn) return;
+
+  initSchema();
+  fileFmt = (logFormat == LOG_FMT_BIN || logFormat == LOG_FMT_ADC) ? logFormat : (uint8_t)LOG_FMT_CSV;
+  rawMode = fileFmt == LOG_FMT_ADC || logEveryMs < LOG_RAW_BELOW_MS;
+  schema  = fileFmt == LOG_FMT_ADC ? &schemaAdc : rawMode ? &schemaRaw : &schema1Hz;
+  segments = 0;
+  if (!openSegment()) { curName=""; loggingOn=false; return; }
+
+  rowsWritten = rowsDropped = 0;
+  rawStarted = false;
+  lastFlushMs = millis();
 
   loggingOn = true;
   Serial.printf("[logging] started: %s\n", curName.c_str());
 }
 
 void stopLogging(){
+  LockGuard g;
   if (!loggingOn) return;
   loggingOn = false;
-  if (logFile) { logFile.flush(); logFile.close(); }
+  closeSegment();
   Serial.println("[logging] stopped");
 }
 
-String currentLogName(){ return loggingOn ? curName : String(""); }
+void logTick(uint32_t now_ms){
+  if (!loggingOn) return;
+  LockGuard g;
+  if (!loggingOn) return;                      // stopped while we waited
+  if (!logFile) {                              // next segment didn't open: retry, never give up
+    if (now_ms - lastOpenTryMs >= STORAGE_CHECK_MS) { lastOpenTryMs = now_ms; openSegment(); }
+    return;
+  }
+  // Rotate by size (bytes handed to the file incl. buffered) or age
+  if (hdrLen + wHead >= segLimit || now_ms - segStartMs >= LOG_SEG_MS) {
+    closeSegment();
+    lastOpenTryMs = lastFlushMs = now_ms;
+    openSegment();
+    return;
+  }
+  if (now_ms - lastFlushMs >= logFlushMs) {
+    lastFlushMs = lastSyncMs = now_ms;
+    flushBuffers();
+    return;
+  }
+  // Tail readers: move the watermark over what is complete (CSV rows, whole
+  // binary blocks) without closing the open block — padding it every second
+  // would store ~one 1 Hz row per 512 B block
+  if (tailFollowers > 0 && now_ms - lastSyncMs >= LOG_TAIL_FLUSH_MS) {
+    lastSyncMs = now_ms;
+    syncData();
+    return;
+  }
+  // Index queue nearly full: commit the data its entries point at first
+  if (idx.full()) { syncData(); return; }
+  // otherwise only hand full chunks to the FS (whole flash pages)
+  if (wUsed() >= LOG_WRITE_CHUNK) wDrain(LOG_WRITE_CHUNK);
+}
+
+void logStats(LogStats &st){
+  st.rows     = rowsWritten;
+  st.dropped  = rowsDropped;
+  st.buffered = wUsed();
+  st.capacity = LOG_WBUF_SIZE;
+  st.segments = segments;
+}
+
+String currentLogName(){ LockGuard g; return loggingOn ? curName : String(""); }
+const char* currentLogNameC(){ return loggingOn ? curName.c_str() : ""; }
 
-// Backward-compatible writer (kept for any legacy call sites)
+// Raw writer: one row per acquired sample, decimated to logEveryMs (0 = all)
 void logWriteRow(const Sample& s){
-  if (!logFile) return;
+  if (!loggingOn) return;
+  if (rawStarted && logEveryMs) {
+    const uint32_t dt = s.t_ms - lastRawMs;
+    if (dt < logEveryMs) return;
+    // stay on the logEveryMs grid; resync only after a gap of more than a period
+    lastRawMs = (dt - logEveryMs >= logEveryMs) ? s.t_ms : lastRawMs + logEveryMs;
+  } else {
+    lastRawMs = s.t_ms;
+  }
+  rawStarted = true;
   const uint64_t unix_ms = (uint64_t)g_timeOffsetMs + (uint64_t)s.t_ms;
+  if (schema == &schemaAdc) {
+    // capture: the ADC words as read, no compensation or zero applied
+    LogRow r;
+    r.unix_ms = unix_ms;
+    r.time_ms = s.t_ms;
+    r.v[0] = (float)s.D1;  r.v[1] = (float)s.D2;
+    r.v[2] = s.absP_Pa;    r.v[3] = s.tempEnv_C;
+    r.v[4] = s.envHum ? s.RH_pct : NAN;
+    r.v[5] = (s.flags & SAMPLE_F_ACTIVE) ? 1 : 0;
+    appendRow(r);
+    return;
+  }
   // Use current global rho for the trailing column
-  logFile.printf("%llu,%lu,%.4f,%.4f,%.3f,%.3f,%.1f,%.1f,%.4f\n",
-                 (unsigned long long)unix_ms,
-                 (unsigned long)s.t_ms,
-                 s.dp_Pa, s.Va_mps,
-                 s.tempP_C, s.tempEnv_C,
-                 s.absP_Pa, s.RH_pct,
-                 rho);
-  logFile.flush();
+  logWriteRow1Hz(unix_ms, s.t_ms, s.dp_Pa, s.Va_mps,
+                 s.tempP_C, s.tempEnv_C, s.absP_Pa, s.RH_pct, rho, nullptr, s.auxDp_Pa,
+                 (s.flags & SAMPLE_F_ACTIVE) ? 1.0f : 0.0f);
 }
 
 // 1 Hz writer
@@ -68,32 +368,60 @@ void logWriteRow1Hz(
   float dp_Pa, float Va_mps,
   float tempP_C, float tempEnv_C,
   float absP_Pa, float RH_pct,
-  float rho_kgm3
+  float rho_kgm3,
+  const LogDpStats* st,
+  const float* aux,
+  float active
 ){
-  if (!logFile) return;
-  logFile.printf("%llu,%lu,%.4f,%.4f,%.3f,%.3f,%.1f,%.1f,%.4f\n",
-                 (unsigned long long)unix_ms,
-                 (unsigned long)time_ms,
-                 dp_Pa, Va_mps,
-                 tempP_C, tempEnv_C,
-                 absP_Pa, RH_pct,
-                 rho_kgm3);
-  logFile.flush();
+  if (!loggingOn) return;
+  LogRow r;
+  r.unix_ms = unix_ms;
+  r.time_ms = time_ms;
+  r.v[0] = dp_Pa;   r.v[1] = Va_mps;
+  r.v[2] = tempP_C; r.v[3] = tempEnv_C;
+  r.v[4] = absP_Pa; r.v[5] = RH_pct;
+  r.v[6] = rho_kgm3;
+  uint8_t k = 7;
+  for (uint8_t i = 0; i < DP_AUX_N; i++) r.v[k++] = aux ? aux[i] : NAN;
+  if (schema == &schema1Hz) {
+    r.v[k++] = st ? st->min : NAN;  r.v[k++] = st ? st->max : NAN;
+    r.v[k++] = st ? st->std : NAN;
+    r.v[k++] = st ? st->p05 : NAN;  r.v[k++] = st ? st->p95 : NAN;
+  }
+  r.v[k++] = active;
+  appendRow(r);
+}
+
+static void sendChunk(const char* p, size_t n, void* ctx){
+  ((WebServer*)ctx)->sendContent(p, n);
 }
 
 void listFilesJSON(WebServer& server){
-  String j = "{\"files\":[";
-  bool first = true;
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
+
+  char buf[512];
+  JsonWriter j(buf, sizeof(buf), sendChunk, &server);
+  j.obj().arr("files");
 
-  File root = SPIFFS.open("/");
+  File root = FLASHFS.open("/");
   File f = root.openNextFile();
   while (f) {
-    if (!first) j += ",";
-    j += "{\"name\":\""; j += f.name(); j += "\",\"size\":";
-    j += String((unsigned long)f.size()); j += "}";
-    first = false;
+    const char* name = f.name();
+    const size_t nl = strlen(name);
+    if (!(nl > 4 && !strcmp(name + nl - 4, ".idx"))) {     // side files
+      j.obj().kvs("name", name).kvu("size", f.size());
+      // time span + rows from the index (logs only)
+      LogIndexReader ix;
+      uint64_t t0, t1; uint32_t rows;
+      if (ix.open(logIndexPath(*name == '/' ? String(name) : "/" + String(name))) && ix.summary(t0, t1, rows))
+        j.kvu("t0", t0).kvu("t1", t1).kvu("rows", rows);
+      ix.close();
+      j.end();
+    }
     f = root.openNextFile();
   }
-  j += "]}";
-  server.send(200, "application/json", j);
+  j.end().end();
+  j.flush();
+  server.sendContent("", 0);
 }
\ No newline at end of file
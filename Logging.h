@@ -2,21 +2,64 @@
 #include "Shared.h"
 #include <FS.h>
 
+// File formats (logFormat setting): .csv text / .bin blocks (LogFormat.h) /
+// .adc capture — binary blocks of the raw D1/D2 ADC words (+ env) with the
+// PROM, zero, scale and invert in the header; converted on download.
+enum : uint8_t { LOG_FMT_CSV = 0, LOG_FMT_BIN = 1, LOG_FMT_ADC = 2 };
+
+// Call once from setup(), before the app and HTTP tasks start
+void   logBegin();
+
 bool   logFileOpen();
+// Raw vs 1 Hz rows, latched when the file was started (logEveryMs < 1000 or
+// capture format → raw)
+bool   logRawMode();
 void   startLogging();
 void   stopLogging();
-String currentLogName();
+String currentLogName();          // open segment of the session (any task)
+const char* currentLogNameC();   // same, without a String copy ("" when idle); app task only
+
+// Periodic flush of the RAM row buffer (every logFlushMs), segment rotation.
+// Call from the app task without AppLock: it takes the logging lock, so a
+// flush to flash only holds up start/stop, not the other handlers.
+void   logTick(uint32_t now_ms);
 
-// legacy row writer (still supported)
+// Committed-length watermark (any task): if fn is the segment being written,
+// len = bytes from offset 0 that reached flash (whole rows/blocks, readable
+// through another handle) and true; false → not active, read to its size.
+// Readers stream straight from flash up to len; the writer never pauses.
+bool   logCommitted(const char* fn, uint32_t& len);
+// Tail readers register while following; the writer then commits what is
+// complete at least every LOG_TAIL_FLUSH_MS (CSV rows, binary blocks once
+// full — the open block is not padded early), so the watermark keeps moving
+void   logTailFollow(bool on);
+
+// Raw (high-rate) writer: one row per sample, at most one per logEveryMs
+// (0 = every sample). Used when logEveryMs < 1000; otherwise rows are 1 Hz.
 void   logWriteRow(const Sample& s);
 
+struct LogStats {
+  uint32_t rows;       // rows handed to the file since logging started
+  uint32_t dropped;    // rows lost because the write buffer was full
+  uint32_t buffered;   // bytes waiting in RAM
+  uint32_t capacity;
+  uint32_t segments;   // files of this session (rotation, Storage.h)
+};
+void   logStats(LogStats &st);
+
+// ΔP spread within one 1 Hz bin (dp_min/max/std/p05/p95 columns)
+struct LogDpStats { float min, max, std, p05, p95; };
+
 // NEW: 1 Hz writer — pass all channels for a single second
 void   logWriteRow1Hz(
   uint64_t unix_ms, uint32_t time_ms,
   float dp_Pa, float Va_mps,
   float tempP_C, float tempEnv_C,
   float absP_Pa, float RH_pct,
-  float rho_kgm3            // <— added
+  float rho_kgm3,           // <— added
+  const LogDpStats* st,     // nullptr → NaN (raw rows)
+  const float* aux = nullptr, // DP_AUX_MAX extra ΔP values (dp1_Pa…), nullptr → NaN
+  float active = NAN          // share of full-rate samples (adaptive rate), 0..1
 );
 
 // file utilities
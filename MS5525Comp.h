@@ -0,0 +1,61 @@
+#pragma once
+// MS5525DSO compensation: raw D1/D2 ADC words → Pa / °C.
+// The PROM-derived terms are folded once into Ms5525Coef so a conversion is
+// a handful of 64-bit multiplies; the live path, trace replay and capture
+// export (batch, after the fact) all share this code. No Arduino dependencies.
+//
+//   dT   = D2 - C5*2^8
+//   TEMP = 2000 + dT*C6 / 2^23          (0.01 °C)
+//   OFF  = C2*2^16 + (C4*dT)/2^7
+//   SENS = C1*2^15 + (C3*dT)/2^8
+//   P    = (D1*SENS/2^21 - OFF)/2^15    (nominally hPa, × scale → Pa)
+#include <stddef.h>
+#include <stdint.h>
+
+struct Ms5525Coef {
+  int32_t tref;        // C5 * 2^8
+  int64_t off0;        // C2 * 2^16
+  int64_t sens0;       // C1 * 2^15
+  int64_t tco, tcs;    // C4, C3
+  int64_t tsens;       // C6
+  float   scale;       // P counts → Pa (MS5525_P_SCALE)
+};
+
+inline void ms5525Prepare(const uint16_t C[8], float scale, Ms5525Coef& k) {
+  k.tref  = (int32_t)C[5] * 256L;
+  k.off0  = (int64_t)C[2] << 16;
+  k.sens0 = (int64_t)C[1] << 15;
+  k.tco   = C[4];
+  k.tcs   = C[3];
+  k.tsens = C[6];
+  k.scale = scale;
+}
+
+inline void ms5525Convert(const Ms5525Coef& k, uint32_t D1, uint32_t D2, float& P_Pa, float& T_C) {
+  const int32_t dT   = (int32_t)D2 - k.tref;
+  int64_t       OFF  = k.off0  + ((k.tco * (int64_t)dT) >> 7);
+  int64_t       SENS = k.sens0 + ((k.tcs * (int64_t)dT) >> 8);
+  const int32_t TEMP = 2000 + (int32_t)(((int64_t)dT * k.tsens) >> 23);
+
+  // 2nd-order compensation (cold)
+  if (TEMP < 2000) {
+    const int64_t t2 = TEMP - 2000;
+    OFF  -= (5 * t2 * t2) >> 1;   // /2
+    SENS -= (5 * t2 * t2) >> 2;   // /4
+  }
+
+  const int32_t Praw = (int32_t)(((((int64_t)D1 * SENS) >> 21) - OFF) >> 15);
+  P_Pa = (float)Praw * k.scale;
+  T_C  = (float)TEMP / 100.0f;
+}
+
+// n conversions; P/T may be null when only one of them is wanted
+inline void ms5525ConvertBatch(const Ms5525Coef& k, const uint32_t* D1, const uint32_t* D2,
+                               size_t n, float* P_Pa, float* T_C) {
+  float p, t;
+  for (size_t i = 0; i < n; i++) {
+    ms5525Convert(k, D1[i], D2[i], p, t);
+    if (P_Pa) P_Pa[i] = p;
+    if (T_C)  T_C[i]  = t;
+  }
+}
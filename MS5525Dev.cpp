@@ -0,0 +1,86 @@
+#include "MS5525Dev.h"
+
+// Opcode = base + 2*osr (osr 0..4 → OSR256…OSR4096)
+constexpr uint8_t OPC_D1    = 0x40;  // pressure
+constexpr uint8_t OPC_D2    = 0x50;  // temperature
+constexpr uint8_t CMD_ADC   = 0x00;
+constexpr uint8_t CMD_RESET = 0x1E;
+constexpr uint8_t CMD_PROM  = 0xA0;
+// MS5525DSO datasheet: max conversion time per OSR (256, 512, 1024, 2048, 4096)
+static const uint16_t CONV_US[MS5525_OSR_STEPS] = { 600, 1170, 2280, 4540, 9040 };
+
+static inline uint8_t clampOsr(uint8_t osr) { return osr < MS5525_OSR_STEPS ? osr : MS5525_OSR_STEPS - 1; }
+
+uint32_t ms5525ConvUs(uint8_t osr) { return CONV_US[clampOsr(osr)]; }
+
+bool Ms5525Dev::reset() {
+  conv_ = Conv::Idle;
+  return port_ && port_->write(addr_, CMD_RESET, true) == 0;
+}
+
+bool Ms5525Dev::readProm(uint16_t C[8]) {
+  if (!port_) return false;
+  for (int i = 0; i < 8; i++) {
+    uint8_t b[2];
+    if (port_->write(addr_, CMD_PROM + 2*i, false) != 0) return false;
+    if (port_->read(addr_, b, 2) != 2) return false;
+    C[i] = (uint16_t(b[0]) << 8) | b[1];
+  }
+  return true;
+}
+
+bool Ms5525Dev::loadProm(float pscale) {
+  if (!readProm(prom_)) return false;
+  ms5525Prepare(prom_, pscale, coef_);
+  return true;
+}
+
+bool Ms5525Dev::start(bool temperature, uint32_t now_us) {
+  const uint8_t osr = temperature ? osrT_ : osrP_;
+  if (!port_ || port_->write(addr_, (temperature ? OPC_D2 : OPC_D1) + 2*osr, true) != 0) {
+    conv_ = Conv::Idle;
+    return false;
+  }
+  conv_    = temperature ? Conv::D2 : Conv::D1;
+  waitUs_  = CONV_US[osr];
+  startUs_ = now_us;
+  return true;
+}
+
+bool Ms5525Dev::collect(uint32_t& adc) {
+  conv_ = Conv::Idle;
+  // Repeated START, then read 3 bytes
+  uint8_t b[3];
+  if (port_->write(addr_, CMD_ADC, false) != 0) return false;
+  if (port_->read(addr_, b, 3) != 3) return false;
+  adc = (uint32_t(b[0]) << 16) | (uint32_t(b[1]) << 8) | b[2];
+  return true;
+}
+
+uint32_t Ms5525Dev::waitUs(uint32_t now_us) const {
+  if (conv_ == Conv::Idle) return 1000;
+  const uint32_t el = now_us - startUs_;
+  return el >= waitUs_ ? 0 : waitUs_ - el;
+}
+
+Ms5525Dev::Step Ms5525Dev::poll(uint32_t now_us) {
+  if (conv_ == Conv::Idle)   // on NACK: stay idle, retry next call
+    return start(!haveD2_ || sinceD2_ >= tempEvery_, now_us) ? Step::Wait : Step::StartFail;
+  if (!ready(now_us)) return Step::Wait;
+
+  const bool wasT = conv_ == Conv::D2;
+  uint32_t adc = 0;
+  const bool ok = collect(adc);
+  if (ok && wasT) { d2_ = adc; haveD2_ = true; sinceD2_ = 0; }
+  else if (ok)    { d1_ = adc; if (sinceD2_ < 255) sinceD2_++; }
+
+  // keep the ADC busy while the caller processes this sample (unless paced)
+  if (!paced_ || wasT || !ok) start(!haveD2_ || sinceD2_ >= tempEvery_, now_us);
+  if (!ok)  return Step::Fail;
+  return wasT ? Step::Temp : Step::Pressure;
+}
+
+void Ms5525Dev::setOsr(uint8_t p, uint8_t t) {
+  osrP_ = clampOsr(p);
+  osrT_ = clampOsr(t);
+}
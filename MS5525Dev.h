@@ -0,0 +1,88 @@
+#pragma once
+// One MS5525DSO on an abstract I2C port: PROM, conversion state and the
+// non-blocking D1/D2 state machine, per instance. No Arduino dependencies —
+// the device wires it to Wire/Wire1 (optionally behind a mux, I2CBus.h);
+// on the host a mock I2cPort can script ACKs, NACKs and ADC words.
+#include <stddef.h>
+#include <stdint.h>
+#include "MS5525Comp.h"
+
+// Transport for one device address. Return codes follow Wire.endTransmission
+// (0 = ACK); read() returns the number of bytes received.
+class I2cPort {
+public:
+  virtual ~I2cPort() {}
+  virtual uint8_t write(uint8_t addr, uint8_t cmd, bool stop) = 0;
+  virtual uint8_t read(uint8_t addr, uint8_t* p, uint8_t n) = 0;
+};
+
+constexpr uint8_t MS5525_OSR_STEPS = 5;      // OSR256 … OSR4096
+
+// Datasheet max conversion time (µs) for osr index 0..4
+uint32_t ms5525ConvUs(uint8_t osr);
+
+class Ms5525Dev {
+public:
+  enum class Conv : uint8_t { Idle, D1, D2 };
+  enum class Step : uint8_t {
+    Wait,        // nothing collected (conversion running, or just started)
+    Temp,        // D2 collected
+    Pressure,    // D1 collected: d1()/d2() form a fresh sample
+    Fail,        // collect failed (conversion lost)
+    StartFail    // idle and the start was NACKed; the next poll() retries
+  };
+
+  void attach(I2cPort* port, uint8_t addr) { port_ = port; addr_ = addr; }
+
+  bool reset();                              // wait ≥ 3 ms before readProm()
+  bool readProm(uint16_t C[8]);
+  // readProm() into the instance copy and prepare the coefficients
+  bool loadProm(float pscale);
+
+  // Low level: one conversion at a time
+  bool     start(bool temperature, uint32_t now_us);
+  bool     ready(uint32_t now_us) const { return conv_ != Conv::Idle && now_us - startUs_ >= waitUs_; }
+  bool     collect(uint32_t& adc);           // always ends the conversion
+  uint32_t waitUs(uint32_t now_us) const;    // 0 = collect now; 1000 when idle
+  Conv     converting() const { return conv_; }
+  uint32_t startedUs()  const { return startUs_; }
+  void     abandon() { conv_ = Conv::Idle; }
+
+  // State machine: collect when ready, then immediately start the next
+  // conversion (D2 first, then once every tempEvery D1s). Never waits.
+  // Idle (paced, or start NACKed) → the call starts a conversion. Idle on
+  // its own is not a failure: only Fail and StartFail are. A restart that is
+  // NACKed right after a collect is retried (and reported) by the next call.
+  Step     poll(uint32_t now_us);
+  // The sample behind the last Step::Pressure (also updated by setRaw())
+  uint32_t d1() const { return d1_; }
+  uint32_t d2() const { return d2_; }
+  void     setRaw(uint32_t D1, uint32_t D2) { d1_ = D1; d2_ = D2; haveD2_ = true; sinceD2_ = 0; }
+  void     convert(float& P_Pa, float& T_C) const { ms5525Convert(coef_, d1_, d2_, P_Pa, T_C); }
+
+  void     setOsr(uint8_t p, uint8_t t);
+  uint8_t  osrP() const { return osrP_; }
+  uint8_t  osrT() const { return osrT_; }
+  // Paced: after a D1 the device is left idle (low power) until the next
+  // poll(); D2 and failed conversions are still followed up immediately
+  void     setPaced(bool on) { paced_ = on; }
+  void     setTempEvery(uint8_t n) { tempEvery_ = n ? n : 1; }
+  uint8_t  tempEvery() const { return tempEvery_; }
+
+  const uint16_t*   prom() const { return prom_; }
+  const Ms5525Coef& coef() const { return coef_; }
+  uint8_t           addr() const { return addr_; }
+
+private:
+  I2cPort*   port_ = nullptr;
+  uint8_t    addr_ = 0x76;
+  uint16_t   prom_[8] = {0};
+  Ms5525Coef coef_ = {};
+  Conv       conv_ = Conv::Idle;
+  uint32_t   startUs_ = 0, waitUs_ = 0;
+  uint8_t    osrP_ = MS5525_OSR_STEPS - 1, osrT_ = MS5525_OSR_STEPS - 1;
+  uint8_t    tempEvery_ = 10, sinceD2_ = 0;
+  bool       haveD2_ = false;
+  bool       paced_ = false;
+  uint32_t   d1_ = 0, d2_ = 0;
+};
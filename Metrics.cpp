@@ -0,0 +1,127 @@
+#include "Metrics.h"
+#include "Config.h"
+#include "Shared.h"
+#include "SensorMS5525.h"
+#include "Sampler.h"
+#include "Logging.h"
+#include "I2CBus.h"
+#include <WebServer.h>
+#include <atomic>
+#include <stdarg.h>
+
+// Upper bucket bounds (µs); one more implicit +Inf bucket
+static const uint32_t BOUNDS_US[] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 100000 };
+constexpr uint8_t NB = sizeof(BOUNDS_US) / sizeof(BOUNDS_US[0]);
+
+struct Hist {
+  uint32_t bucket[NB + 1];
+  uint32_t count;
+  uint64_t sumUs;       // single writer; a reader may rarely see a torn value
+  uint32_t maxUs;
+};
+static Hist hist[STAGE_COUNT];
+static std::atomic<uint32_t> counters[CNT_COUNT];
+
+static const char* STAGE_NAME[STAGE_COUNT] = { "conv", "env", "agg", "log", "http" };
+
+void metricStage(MetricStage s, uint32_t us){
+  Hist& h = hist[s];
+  uint8_t b = 0;
+  while (b < NB && us > BOUNDS_US[b]) b++;
+  h.bucket[b]++;
+  h.count++;
+  h.sumUs += us;
+  if (us > h.maxUs) h.maxUs = us;
+}
+
+void metricCount(MetricCounter c){ counters[c].fetch_add(1, std::memory_order_relaxed); }
+uint32_t metricGet(MetricCounter c){ return counters[c].load(std::memory_order_relaxed); }
+
+uint8_t metricI2c(uint8_t rc){
+  // Arduino-ESP32: 2 = address NACK, 3 = data NACK, 5 = timeout
+  if      (rc == 2 || rc == 3) metricCount(CNT_I2C_NACK);
+  else if (rc == 5)            metricCount(CNT_I2C_TIMEOUT);
+  else if (rc)                 metricCount(CNT_I2C_OTHER);
+  return rc;
+}
+
+// ---------- text exposition ----------
+struct Out {
+  WebServer& srv;
+  char       buf[512];
+  size_t     n = 0;
+  explicit Out(WebServer& s) : srv(s) {}
+  void printf(const char* f, ...){
+    va_list ap;
+    for (int tries = 0; tries < 2; tries++) {
+      va_start(ap, f);
+      int k = vsnprintf(buf + n, sizeof(buf) - n, f, ap);
+      va_end(ap);
+      if (k >= 0 && n + k < sizeof(buf)) { n += k; return; }
+      flush();                            // didn't fit: send and retry once
+    }
+  }
+  void flush(){ if (n) srv.sendContent(buf, n); n = 0; }
+};
+
+static void gauge(Out& o, const char* name, const char* help, double v){
+  o.printf("# HELP %s %s\n# TYPE %s gauge\n%s %.6g\n", name, help, name, name, v);
+}
+static void counter(Out& o, const char* name, const char* help, uint32_t v){
+  o.printf("# HELP %s %s\n# TYPE %s counter\n%s %lu\n", name, help, name, name, (unsigned long)v);
+}
+
+void metricsText(WebServer& server){
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+  Out o(server);
+
+  o.printf("# HELP aero_stage_seconds Latency of pipeline stages\n# TYPE aero_stage_seconds histogram\n");
+  for (uint8_t s = 0; s < STAGE_COUNT; s++) {
+    const Hist h = hist[s];
+    uint32_t cum = 0;
+    for (uint8_t b = 0; b < NB; b++) {
+      cum += h.bucket[b];
+      o.printf("aero_stage_seconds_bucket{stage=\"%s\",le=\"%g\"} %lu\n",
+               STAGE_NAME[s], BOUNDS_US[b] / 1e6, (unsigned long)cum);
+    }
+    cum += h.bucket[NB];
+    o.printf("aero_stage_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %lu\n", STAGE_NAME[s], (unsigned long)cum);
+    o.printf("aero_stage_seconds_sum{stage=\"%s\"} %.6f\n", STAGE_NAME[s], h.sumUs / 1e6);
+    o.printf("aero_stage_seconds_count{stage=\"%s\"} %lu\n", STAGE_NAME[s], (unsigned long)cum);
+  }
+  o.printf("# HELP aero_stage_max_seconds Worst stage latency since boot\n# TYPE aero_stage_max_seconds gauge\n");
+  for (uint8_t s = 0; s < STAGE_COUNT; s++)
+    o.printf("aero_stage_max_seconds{stage=\"%s\"} %.6f\n", STAGE_NAME[s], hist[s].maxUs / 1e6);
+
+  counter(o, "aero_ms5525_conv_retries_total",  "Blocking conversions that needed a retry", counters[CNT_CONV_RETRY]);
+  counter(o, "aero_ms5525_conv_failures_total", "Failed MS5525 conversions",               counters[CNT_CONV_FAIL]);
+  o.printf("# HELP aero_i2c_errors_total I2C transaction errors\n# TYPE aero_i2c_errors_total counter\n");
+  static const char* KIND[] = { "nack", "timeout", "short", "other" };
+  for (uint8_t k = 0; k < 4; k++)
+    o.printf("aero_i2c_errors_total{kind=\"%s\"} %lu\n", KIND[k], (unsigned long)counters[CNT_I2C_NACK + k].load());
+
+  counter(o, "aero_rate_bursts_total",        "Adaptive rate: quiet → full rate",       counters[CNT_RATE_BURST]);
+  counter(o, "aero_rate_quiets_total",        "Adaptive rate: full rate → quiet",       counters[CNT_RATE_QUIET]);
+  gauge(o,   "aero_rate_active",              "1 = full rate, 0 = quiet cadence",       samplerActive() ? 1 : 0);
+  gauge(o,   "aero_i2c_clock_hz",             "Current I2C bus clock",                  busHz());
+  counter(o, "aero_i2c_fallbacks_total",      "Bus clock step-downs after errors",      busFallbacks());
+
+  float sps, noise; sensorRateNoise(sps, noise);
+  SamplerStats ss; samplerStats(ss);
+  LogStats ls; logStats(ls);
+  gauge(o,   "aero_sample_rate_hz",           "Pressure samples per second",            sps);
+  gauge(o,   "aero_pressure_noise_pa",        "Std-dev of P over the last second",      noise);
+  counter(o, "aero_samples_total",            "Samples produced by the sampler task",   ss.produced);
+  counter(o, "aero_ring_overflows_total",     "Samples dropped (ring full)",            ss.overflows);
+  gauge(o,   "aero_ring_high_water",          "Max sample ring occupancy",              ss.highWater);
+  counter(o, "aero_log_rows_total",           "Log rows written",                       ls.rows);
+  counter(o, "aero_log_rows_dropped_total",   "Log rows dropped (write buffer full)",   ls.dropped);
+  gauge(o,   "aero_heap_free_bytes",          "Free heap",                              ESP.getFreeHeap());
+  gauge(o,   "aero_heap_min_free_bytes",      "Lowest free heap since boot",            ESP.getMinFreeHeap());
+  gauge(o,   "aero_heap_max_alloc_bytes",     "Largest free heap block",                ESP.getMaxAllocHeap());
+  gauge(o,   "aero_uptime_seconds",           "Seconds since boot",                     millis() / 1000.0);
+
+  o.flush();
+  server.sendContent("", 0);
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <Arduino.h>
+
+class WebServer;
+
+// Low-overhead runtime metrics for /api/metrics (Prometheus text format).
+// Stage latencies go into fixed log-spaced histograms (a few compares and
+// two adds per observation); counters are relaxed atomics. Each stage is
+// written by one task only.
+
+enum MetricStage : uint8_t {
+  STAGE_CONV,     // MS5525 conversion: start → collect (sampler task)
+  STAGE_ENV,      // envRead() (sampler task)
+  STAGE_AGG,      // processSample() (app task)
+  STAGE_LOG,      // logTick() flash writes (app task)
+  STAGE_HTTP,     // server.handleClient() (HTTP task, incl. handlers)
+  STAGE_COUNT
+};
+
+enum MetricCounter : uint8_t {
+  CNT_CONV_RETRY,     // blocking convert() needed a second attempt
+  CNT_CONV_FAIL,      // conversion start/collect failed
+  CNT_I2C_NACK,       // address or data NACK
+  CNT_I2C_TIMEOUT,
+  CNT_I2C_SHORT,      // requestFrom() returned fewer bytes
+  CNT_I2C_OTHER,
+  CNT_RATE_BURST,     // adaptive scheduler: quiet → full rate
+  CNT_RATE_QUIET,     // full rate → quiet cadence
+  CNT_COUNT
+};
+
+void metricStage(MetricStage s, uint32_t us);
+void metricCount(MetricCounter c);
+uint32_t metricGet(MetricCounter c);
+
+// Classify a Wire.endTransmission() result (counted when non-zero); returns rc
+uint8_t metricI2c(uint8_t rc);
+
+// Times the enclosing scope into a stage histogram
+struct StageTimer {
+  MetricStage s;
+  uint32_t    t0;
+  explicit StageTimer(MetricStage st) : s(st), t0(micros()) {}
+  ~StageTimer() { metricStage(s, micros() - t0); }
+};
+
+// HTTP handler body for /api/metrics
+void metricsText(WebServer& server);
@@ -4,11 +4,20 @@
 #include "Logging.h"
 #include "WebUI.h"
 #include "EnvSensor.h"
-#include <algorithm>   // nth_element
-#include <vector>      // std::vector
+#include "Sampler.h"
+#include "LiveStream.h"
+#include "Snapshot.h"
+#include "StreamStats.h"
+#include "History.h"
+#include "Trace.h"
+#include "Metrics.h"
+#include "I2CBus.h"
+#include "DpAux.h"
+#include "Storage.h"
+#include "AirFilter.h"
 #include <WiFi.h>
 #include <WebServer.h>
-#include <SPIFFS.h>
+#include "FlashFS.h"
 #include <ESPmDNS.h>
 #include <math.h>
 
@@ -16,14 +25,24 @@ WebServer server(80);
 
 // ====== globals in Shared.h (defined here) ======
 Preferences prefs;
-Sample  lastS      = {0,0,0,0};
+Sample  lastS      = {};
 float   dp_zero    = 0.0f;
 float   rho        = DEFAULT_RHO;
 bool    invertDP   = false;
+float   dpAuxZero[DP_AUX_MAX]   = {};
+bool    dpAuxInvert[DP_AUX_MAX] = {};
 uint32_t logEveryMs= DEFAULT_LOG_MS;   // make sure DEFAULT_LOG_MS = 1000 in Config.h
+uint8_t  logFormat = DEFAULT_LOG_FMT;
+uint32_t logFlushMs= DEFAULT_FLUSH_MS;
+uint8_t  logKeepPct= DEFAULT_KEEP_PCT;
+bool     adaptiveRate = true;
+uint16_t airFilterMs = AIR_FILTER_MS;
+uint32_t liveFrameMs = DEFAULT_FRAME_MS;
 uint32_t bootCounter = 0;
 bool    loggingOn  = false;
 bool g_showSpeed = true;   // default visible at boot
+PipeStats pipeStats = {};
+SemaphoreHandle_t appMutex = nullptr;
 bool  autoRho   = true;   // always compute ρ from env sensor
 float envP_Pa   = NAN;
 float envT_C    = NAN;
@@ -39,25 +58,55 @@ int       g_tzOffsetMin  = 0;
 // constexpr uint32_t QUIET_TIME_MS      = 10000;    // quiet this long → nudge zero
 // constexpr float    ZERO_NUDGE_ALPHA   = 0.02f;    // move 2% towards P per nudge
 
-constexpr float    DISP_DP_THRESH_PA  = 2.0f;     // need |dp| ≥ this to show speed
-constexpr uint32_t DISP_HOLD_MS       = 1000;     // sustain threshold this long
-constexpr float    DP_DEADBAND        = 2.0f;     // Pa: suppress tiny bumps at rest
+// Speed display gate: AIR_GATE_* in Config.h (hysteresis on filtered ΔP)
+constexpr float    DP_DEADBAND        = 2.0f;     // Pa: 1 Hz rows, suppress tiny bumps at rest
 
 // Runtime state
 // static uint32_t g_quietStartMs = 0;     // when we entered quiet
 // static uint32_t g_overStartMs  = 0;     // when we exceeded display threshold
 
+static void appTask(void*);
+
 // ---- settings I/O ----
 static void loadSettings() {
   dp_zero    = prefs.getFloat("dp_zero", 0.0f);
   invertDP   = prefs.getBool ("inv", false);
   logEveryMs = prefs.getUInt ("logms", DEFAULT_LOG_MS);
+  logFormat  = prefs.getUChar("logfmt", DEFAULT_LOG_FMT);
+  logFlushMs = prefs.getUInt ("flushms", DEFAULT_FLUSH_MS);
+  logKeepPct = prefs.getUChar("keep", DEFAULT_KEEP_PCT);
+  adaptiveRate = prefs.getBool("adapt", true);
+  airFilterMs  = prefs.getUShort("filtms", AIR_FILTER_MS);
+  liveFrameMs= prefs.getUInt ("streamms", DEFAULT_FRAME_MS);
+  sensorSetTempEvery(prefs.getUChar("tevery", MS5525_TEMP_EVERY));
+  sensorSetOsr(prefs.getUChar("osrP", MS5525_OSR_P), prefs.getUChar("osrT", MS5525_OSR_T));
+  envSetRateHz(prefs.getUChar("envhz", ENV_DEFAULT_HZ));
   autoRho    = true; // force auto ρ from env sensor
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    char k[8];
+    snprintf(k, sizeof(k), "dpz%u", i + 1); dpAuxZero[i]   = prefs.getFloat(k, 0.0f);
+    snprintf(k, sizeof(k), "dpi%u", i + 1); dpAuxInvert[i] = prefs.getBool(k, false);
+  }
 }
 static void saveSettings() {
   prefs.putFloat("dp_zero", dp_zero);
   prefs.putBool ("inv", invertDP);
   prefs.putUInt ("logms", logEveryMs);
+  prefs.putUChar("logfmt", logFormat);
+  prefs.putUInt ("flushms", logFlushMs);
+  prefs.putUChar("keep", logKeepPct);
+  prefs.putBool ("adapt", adaptiveRate);
+  prefs.putUShort("filtms", airFilterMs);
+  prefs.putUInt ("streamms", liveFrameMs);
+  prefs.putUChar("tevery", sensorTempEvery());
+  prefs.putUChar("osrP", sensorOsrP());
+  prefs.putUChar("osrT", sensorOsrT());
+  prefs.putUChar("envhz", envRateHz());
+  for (uint8_t i = 0; i < DP_AUX_N; i++) {
+    char k[8];
+    snprintf(k, sizeof(k), "dpz%u", i + 1); prefs.putFloat(k, dpAuxZero[i]);
+    snprintf(k, sizeof(k), "dpi%u", i + 1); prefs.putBool(k, dpAuxInvert[i]);
+  }
 }
 
 void setup() {
@@ -65,7 +114,8 @@ void setup() {
   delay(30);
 
   // Filesystem
-  if (!SPIFFS.begin(true)) Serial.println("SPIFFS mount failed");
+  storageBegin();
+  logBegin();
 
   // NVS
   prefs.begin("aerosens", false);
@@ -74,12 +124,15 @@ void setup() {
   loadSettings();
 
   // Sensors
+  busBegin();
   sensorBegin();
+  dpAuxBegin(); // extra ΔP sensors (DP_AUX), if any
+  envBegin();   // start BME/BMP280 (or BMP280)
+  busTune();    // fastest clock the wiring passes verification at
   if (fabsf(dp_zero) < 0.001f) {  // first boot
     doZero(2000);
     saveSettings();
   }
-  envBegin();   // start BME/BMP280 (or BMP280)
 
   // Wi-Fi AP + mDNS
   WiFi.mode(WIFI_AP);
@@ -89,20 +142,28 @@ void setup() {
   Serial.printf("AP: %s  PW: %s  → http://%s/  or  http://%s.local/\n",
                 AP_SSID, AP_PASS, AP_IP.toString().c_str(), MDNS_NAME);
 
-  // Web server
+  // Web server: own task (+ download workers), handlers under AppLock
+  appMutex = xSemaphoreCreateMutex();
   setupHTTP(server, saveSettings);
+
+  // Acquisition on SAMPLER_CORE, everything else on APP_CORE
+  samplerBegin();
+  xTaskCreatePinnedToCore(appTask, "app", APP_STACK, nullptr, APP_PRIO, nullptr, APP_CORE);
+  httpBegin(server);
 }
 
-void loop() {
-  // Refresh environment
-  float pPa, tC_env, rH; 
-  bool hasH;
-  if (envRead(pPa, tC_env, rH, hasH)) {
-    envP_Pa = pPa; 
-    envT_C  = tC_env; 
-    envRH   = rH; 
-    envHasHum = hasH;
-    if (autoRho) {
+// Consume one raw sample from the sampler: zero, gate, publish, aggregate
+static void processSample(const Sample &in) {
+  // Refresh environment (latest reading carried on the sample)
+  if (!isnan(in.absP_Pa) && !isnan(in.tempEnv_C)) {
+    envP_Pa   = in.absP_Pa;
+    envT_C    = in.tempEnv_C;
+    envRH     = in.RH_pct;
+    envHasHum = in.envHum;
+    // env is carried on every sample but only changes at envRateHz()
+    static float rhoP = NAN, rhoT = NAN, rhoH = NAN;
+    if (autoRho && (envP_Pa != rhoP || envT_C != rhoT || envRH != rhoH)) {
+      rhoP = envP_Pa; rhoT = envT_C; rhoH = envRH;
       float rhoNew = envComputeRho(envP_Pa, envT_C, envRH, envHasHum);
       if (rhoNew > 0.5f && rhoNew < 2.0f) rho = rhoNew;
     }
@@ -112,125 +173,219 @@ void loop() {
   struct Agg {
     uint32_t  sec_idx = 0;     // epoch seconds key
     bool      init    = false;
-    // We use small vectors—~20 samples/sec is tiny for ESP32 RAM
-    std::vector<float> v_dp;
+    // Fixed memory whatever the sample rate: no per-second allocation or sort
+    StreamStats<AGG_EXACT_N> dp;
+    HistAcc va, tc;            // min/mean/max for the history tiers
+    HistAcc aux[DP_AUX_MAX];   // extra ΔP sensors: bin mean (NaN ignored)
     float sum_tempP   = 0, sum_tempEnv = 0, sum_absP = 0, sum_RH = 0;
     uint16_t n        = 0;
+    uint16_t nActive  = 0;     // samples taken at the full rate (adaptive)
     void reset(uint32_t sec) {
       sec_idx = sec; init = true;
-      v_dp.clear(); v_dp.reserve(64);
+      dp.reset(); va.reset(); tc.reset();
+      for (HistAcc& a : aux) a.reset();
       sum_tempP = sum_tempEnv = sum_absP = sum_RH = 0;
-      n = 0;
+      n = nActive = 0;
     }
   };
   static Agg agg;
 
-  // Read differential pressure & compute speed (with your nudge + gating)
-  float P, T_pressure;  // T from MS5525 (°C)
-  if (sensorReadPT(P, T_pressure)) {
-    float dp_raw = (invertDP ? -1.0f : 1.0f) * (P - dp_zero);
-
-    // Quiet auto-zero nudge
-    static uint32_t g_quietStartMs = 0;
-    constexpr float    QUIET_DP_THRESH_PA = 1.0f;
-    constexpr uint32_t QUIET_TIME_MS      = 10000;
-    constexpr float    ZERO_NUDGE_ALPHA   = 0.02f;
-
-    if (fabsf(dp_raw) < QUIET_DP_THRESH_PA) {
-      if (g_quietStartMs == 0) g_quietStartMs = millis();
-      if (millis() - g_quietStartMs >= QUIET_TIME_MS) {
-        dp_zero += (P - dp_zero) * ZERO_NUDGE_ALPHA;
-        g_quietStartMs = millis();
-      }
-    } else {
-      g_quietStartMs = 0;
+  // Trace replay starts from a clean pipeline so results are reproducible
+  const bool restart = in.flags & SAMPLE_F_RESET;
+  if (restart) agg.init = false;
+  pipeStats.samples++;
+
+  // Differential pressure & speed (with your nudge + gating)
+  const float P          = in.P_Pa;
+  const float T_pressure = in.tempP_C;   // T from MS5525 (°C)
+  const uint32_t now     = in.t_ms;      // sample time, not processing time
+
+  // Background zero job (POST /api/zero) averages the raw P stream
+  if (zeroFeed(now, P, in.auxP_Pa)) saveSettings();
+
+  float dp_raw = (invertDP ? -1.0f : 1.0f) * (P - dp_zero);
+
+  // Quiet auto-zero nudge
+  static uint32_t g_quietStartMs = 0;
+  if (restart) g_quietStartMs = 0;
+  constexpr float    QUIET_DP_THRESH_PA = 1.0f;
+  constexpr uint32_t QUIET_TIME_MS      = 10000;
+  constexpr float    ZERO_NUDGE_ALPHA   = 0.02f;
+
+  if (fabsf(dp_raw) < QUIET_DP_THRESH_PA) {
+    if (g_quietStartMs == 0) g_quietStartMs = now;
+    if (now - g_quietStartMs >= QUIET_TIME_MS) {
+      dp_zero += (P - dp_zero) * ZERO_NUDGE_ALPHA;
+      g_quietStartMs = now;
+      pipeStats.nudges++;
     }
+  } else {
+    g_quietStartMs = 0;
+  }
 
-    float dp = (invertDP ? -1.0f : 1.0f) * (P - dp_zero);
-
-    // Gating (require |dp| >= 2 Pa sustained for 1 s)
-    constexpr float DP_GATE = 2.0f;
-    constexpr uint32_t MIN_HOLD = 1000;
-    static uint32_t gateStart = 0;
-    static bool armed = false;
-    if (fabsf(dp) >= DP_GATE) {
-      if (!armed) { gateStart = millis(); armed = true; }
-      if (millis() - gateStart >= MIN_HOLD) g_showSpeed = true;
-    } else {
-      g_showSpeed = false;
-      armed = false;
-    }
+  float dp = (invertDP ? -1.0f : 1.0f) * (P - dp_zero);
+
+  // Low-pass + hysteresis gate (fixed latency 2τ instead of a 1 s hold)
+  static AirFilter filt;
+  static uint32_t  prevMs = 0;
+  if (restart) { filt.reset(); g_showSpeed = false; }
+  filt.setTauMs(airFilterMs);
+  const float dp_f = filt.step(dp, (now - prevMs) * 1e-3f);
+  prevMs = now;
+  const bool wasShown = g_showSpeed;
+  g_showSpeed = filt.gate(dp_f, AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+  if (g_showSpeed != wasShown) (g_showSpeed ? pipeStats.gateOn : pipeStats.gateOff)++;
+
+  // Detection latency (reported by trace replay): raw onset → gate open
+  static uint32_t onsetMs = 0;
+  static bool     onset   = false;
+  if (restart) onset = false;
+  if (!wasShown && !onset && fabsf(dp) >= AIR_GATE_ON_PA) { onset = true; onsetMs = now; }
+  if (g_showSpeed && !wasShown && onset) {
+    const uint32_t lat = now - onsetMs;
+    pipeStats.onsets++;
+    pipeStats.latSumMs += lat;
+    pipeStats.latMaxMs  = max(pipeStats.latMaxMs, lat);
+    onset = false;
+  } else if (!g_showSpeed && onset && fabsf(dp) < AIR_GATE_OFF_PA) {
+    pipeStats.missed++;
+    onset = false;
+  }
 
-    // Deadband for tiny bumps
-    constexpr float DP_DEADBAND = 2.0f;
-    const float dp_used = (fabsf(dp) < DP_DEADBAND) ? 0.0f : dp;
-
-    // Speed from ΔP (use magnitude, gating handled by g_showSpeed)
-    const float rho_use = (rho > 0.01f) ? rho : 1.225f;
-    const float Va_now = g_showSpeed ? sqrtf(2.0f * fabsf(dp_used) / rho_use) : 0.0f;
-
-    // Publish latest sample for UI
-    lastS.t_ms     = millis();
-    lastS.dp_Pa    = dp;
-    lastS.temp_C   = (envHasHum || !isnan(envT_C)) ? envT_C : T_pressure;
-    lastS.Va_mps   = Va_now;
-    lastS.tempP_C  = T_pressure;
-    lastS.tempEnv_C= (envHasHum || !isnan(envT_C)) ? envT_C : NAN;
-    lastS.absP_Pa  = isnan(envP_Pa) ? 0.0f : envP_Pa;
-    lastS.RH_pct   = (envHasHum && !isnan(envRH)) ? envRH : 0.0f;
-
-    // ---- 1 Hz binning by real time ----
-    const uint64_t now_unix_ms = (uint64_t)g_timeOffsetMs + (uint64_t)millis();
-    const uint32_t now_sec     = (uint32_t)(now_unix_ms / 1000ULL);
-
-    if (!agg.init) {
-      agg.reset(now_sec);
-    }
+  // Speed from filtered ΔP (use magnitude, gating handled by g_showSpeed)
+  const float rho_use = (rho > 0.01f) ? rho : 1.225f;
+  const float Va_now = g_showSpeed ? sqrtf(2.0f * fabsf(dp_f) / rho_use) : 0.0f;
+
+  // Publish latest sample for UI
+  lastS.t_ms     = now;
+  lastS.dp_Pa    = dp;
+  lastS.temp_C   = (envHasHum || !isnan(envT_C)) ? envT_C : T_pressure;
+  lastS.Va_mps   = Va_now;
+  lastS.tempP_C  = T_pressure;
+  lastS.tempEnv_C= (envHasHum || !isnan(envT_C)) ? envT_C : NAN;
+  lastS.absP_Pa  = isnan(envP_Pa) ? 0.0f : envP_Pa;
+  lastS.RH_pct   = (envHasHum && !isnan(envRH)) ? envRH : 0.0f;
+  lastS.envHum   = envHasHum;
+  lastS.D1       = in.D1;    // capture logs store the words, not dp
+  lastS.D2       = in.D2;
+  lastS.flags    = in.flags;
+  for (uint8_t i = 0; i < DP_AUX_MAX; i++) {
+    lastS.auxP_Pa[i]  = in.auxP_Pa[i];
+    lastS.auxDp_Pa[i] = (dpAuxInvert[i] ? -1.0f : 1.0f) * (in.auxP_Pa[i] - dpAuxZero[i]);   // NaN stays NaN
+  }
+
+  // Display smoothing: once per sample, shared by every client
+  static int sn = 0; sn = restart ? 1 : min(10, sn+1);
+  lastS.dp_s += (lastS.dp_Pa  - lastS.dp_s) / sn;
+  lastS.tc_s += (lastS.temp_C - lastS.tc_s) / sn;
+
+  liveStreamPush(lastS);
+
+  // High-rate capture: every sample (or one per logEveryMs) instead of 1 Hz rows
+  const bool rawLog = loggingOn ? logRawMode() : logEveryMs < LOG_RAW_BELOW_MS;
+  if (rawLog && loggingOn) logWriteRow(lastS);   // no file between segments → counted as dropped
 
-    if (now_sec != agg.sec_idx) {
-      // CLOSE previous bin → compute robust stats and write 1 Hz row
-      if (agg.n > 0) {
-        // Median ΔP
-        auto v = agg.v_dp;
-        std::nth_element(v.begin(), v.begin() + v.size()/2, v.end());
-        float dp_median = v[v.size()/2];
-
-        // Use median ΔP for speed
-        float Va_1Hz = (fabsf(dp_median) < DP_DEADBAND || !g_showSpeed) ? 0.0f
-                         : sqrtf(2.0f * fabsf(dp_median) / rho_use);
-
-        // Means for others
-        const float tempP   = agg.sum_tempP   / agg.n;
-        const float tempEnv = (agg.sum_tempEnv > 0 && agg.n>0) ? (agg.sum_tempEnv/agg.n) : NAN;
-        const float absP    = agg.sum_absP    / agg.n;
-        const float RH      = (agg.sum_RH>0) ? (agg.sum_RH/agg.n) : 0.0f;
-
-        // Timestamp for the row: align to bin end (exact second boundary)
-        const uint64_t row_unix_ms = (uint64_t)agg.sec_idx * 1000ULL;   // end of that second
-        const uint32_t row_time_ms = (uint32_t)((agg.sec_idx * 1000ULL) - (uint64_t)g_timeOffsetMs);
-
-        if (loggingOn && logFileOpen()) {
-                  logWriteRow1Hz(row_unix_ms, row_time_ms,
-                 dp_median, Va_1Hz,
-                 tempP, tempEnv,
-                 absP, RH,
-                 rho /* rho_kgm3 */);
-        }
+  // ---- 1 Hz binning by real time ----
+  const uint64_t now_unix_ms = (uint64_t)g_timeOffsetMs + (uint64_t)now;
+  const uint32_t now_sec     = (uint32_t)(now_unix_ms / 1000ULL);
+
+  if (!agg.init) {
+    agg.reset(now_sec);
+  }
+
+  if (now_sec != agg.sec_idx) {
+    // CLOSE previous bin → compute robust stats and write 1 Hz row
+    if (agg.n > 0) {
+      pipeStats.bins++;
+      // Median ΔP
+      const float dp_median = agg.dp.median();
+
+      // Use median ΔP for speed
+      float Va_1Hz = (fabsf(dp_median) < DP_DEADBAND || !g_showSpeed) ? 0.0f
+                       : sqrtf(2.0f * fabsf(dp_median) / rho_use);
+
+      // Means for others
+      const float tempP   = agg.sum_tempP   / agg.n;
+      const float tempEnv = (agg.sum_tempEnv > 0 && agg.n>0) ? (agg.sum_tempEnv/agg.n) : NAN;
+      const float absP    = agg.sum_absP    / agg.n;
+      const float RH      = (agg.sum_RH>0) ? (agg.sum_RH/agg.n) : 0.0f;
+
+      // Timestamp for the row: align to bin end (exact second boundary)
+      const uint64_t row_unix_ms = (uint64_t)agg.sec_idx * 1000ULL;   // end of that second
+      const uint32_t row_time_ms = (uint32_t)((agg.sec_idx * 1000ULL) - (uint64_t)g_timeOffsetMs);
+
+      historyAdd(agg.sec_idx, HistStat{ agg.dp.min, (float)agg.dp.mean, agg.dp.max },
+                 agg.va.stat(), agg.tc.stat());
+
+      if (!rawLog && loggingOn) {
+        const LogDpStats st{ agg.dp.min, agg.dp.max, agg.dp.stddev(), agg.dp.p05(), agg.dp.p95() };
+        float aux[DP_AUX_MAX];
+        for (uint8_t i = 0; i < DP_AUX_MAX; i++) aux[i] = agg.aux[i].stat().mean;
+        logWriteRow1Hz(row_unix_ms, row_time_ms,
+               dp_median, Va_1Hz,
+               tempP, tempEnv,
+               absP, RH,
+               rho /* rho_kgm3 */, &st, aux, (float)agg.nActive / agg.n);
       }
-      // OPEN new bin
-      agg.reset(now_sec);
     }
+    // OPEN new bin
+    agg.reset(now_sec);
+  }
+
+  // accumulate current sample to active bin
+  agg.dp.add(dp);
+  agg.va.add(Va_now);
+  agg.tc.add(lastS.temp_C);
+  for (uint8_t i = 0; i < DP_AUX_N; i++) agg.aux[i].add(lastS.auxDp_Pa[i]);
+  agg.sum_tempP   += T_pressure;
+  agg.sum_tempEnv += (envHasHum || !isnan(envT_C)) ? envT_C : 0.0f;
+  agg.sum_absP    += isnan(envP_Pa) ? 0.0f : envP_Pa;
+  agg.sum_RH      += (envHasHum && !isnan(envRH)) ? envRH : 0.0f;
+  agg.n++;
+  if (in.flags & SAMPLE_F_ACTIVE) agg.nActive++;
+}
+
+// One popped sample through the app side of the pipeline
+static void appSample(const Sample& s) {
+  traceConsume(s);
+  StageTimer t(STAGE_AGG);
+  processSample(s);
+}
 
-    // accumulate current sample to active bin
-    agg.v_dp.push_back(dp);
-    agg.sum_tempP   += T_pressure;
-    agg.sum_tempEnv += (envHasHum || !isnan(envT_C)) ? envT_C : 0.0f;
-    agg.sum_absP    += isnan(envP_Pa) ? 0.0f : envP_Pa;
-    agg.sum_RH      += (envHasHum && !isnan(envRH)) ? envRH : 0.0f;
-    agg.n++;
+// Per-batch housekeeping after the samples (fresh: at least one was processed)
+static void appHousekeeping(bool fresh) {
+  traceTick(millis());
+
+  // Publish the /api/sample snapshot once per batch (and at least 4×/s so
+  // logging state stays current even if the sensor stalls)
+  static uint32_t lastPub = 0;
+  if (fresh || millis() - lastPub >= 250) { snapshotPublish(); lastPub = millis(); }
+  storageTick(millis());
+  liveStreamTick(millis());
+}
+
+// App task (APP_CORE): drain the sample ring, log, push the live stream.
+// HTTP runs in its own lower-priority task (httpBegin); a handler only holds
+// the app lock while it runs, a download none at all.
+static void appTask(void*) {
+  for (;;) {
+    {
+      AppLock lock;     // handlers get it while we sleep below
+      Sample s;
+      bool fresh = false;
+      // bounded batch: a trace replay keeps the ring full, HTTP must still get the lock
+      for (size_t n = 0; n < SAMPLE_RING_LEN && samplerPop(s); n++) {
+        appSample(s);
+        fresh = true;
+      }
+      appHousekeeping(fresh);
+    }
+    { StageTimer t(STAGE_LOG); logTick(millis()); }   // may flush: outside AppLock
+    vTaskDelay(1);  // yield; logging is 1 Hz by binning
   }
+}
 
-  // Service HTTP
-  server.handleClient();
-  delay(10); // keep loop lively for better stats; logging is 1 Hz by binning
+void loop() {
+  // Work runs in the sampler/app tasks; retire the Arduino loop task
+  vTaskDelete(NULL);
 }
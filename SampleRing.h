@@ -0,0 +1,50 @@
+#pragma once
+// Lock-free single-producer / single-consumer ring.
+// Producer: sampling task (core 1). Consumer: app task (core 0).
+// No Arduino dependencies so it builds on the host as well.
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "ring size must be a power of two");
+
+public:
+  // Producer side. Returns false (and counts an overflow) when full — the
+  // newest sample is dropped so the consumer never sees a torn record.
+  bool push(const T& v) {
+    const uint32_t h = head_.load(std::memory_order_relaxed);
+    const uint32_t t = tail_.load(std::memory_order_acquire);
+    if (h - t >= N) { overflows_.fetch_add(1, std::memory_order_relaxed); return false; }
+    buf_[h & (N - 1)] = v;
+    head_.store(h + 1, std::memory_order_release);
+    const uint32_t used = h + 1 - t;
+    if (used > highWater_.load(std::memory_order_relaxed))
+      highWater_.store(used, std::memory_order_relaxed);
+    return true;
+  }
+
+  // Consumer side.
+  bool pop(T& out) {
+    const uint32_t t = tail_.load(std::memory_order_relaxed);
+    const uint32_t h = head_.load(std::memory_order_acquire);
+    if (t == h) return false;
+    out = buf_[t & (N - 1)];
+    tail_.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t   size()      const { return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire); }
+  size_t   capacity()  const { return N; }
+  uint32_t pushed()    const { return head_.load(std::memory_order_relaxed); }
+  uint32_t overflows() const { return overflows_.load(std::memory_order_relaxed); }
+  uint32_t highWater() const { return highWater_.load(std::memory_order_relaxed); }
+
+private:
+  T buf_[N];
+  std::atomic<uint32_t> head_{0};       // written by producer only
+  std::atomic<uint32_t> tail_{0};       // written by consumer only
+  std::atomic<uint32_t> overflows_{0};
+  std::atomic<uint32_t> highWater_{0};
+};
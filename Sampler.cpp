@@ -0,0 +1,119 @@
+#include "Sampler.h"
+#include "Config.h"
+#include "SampleRing.h"
+#include "SensorMS5525.h"
+#include "EnvSensor.h"
+#include "Trace.h"
+#include "Metrics.h"
+#include "I2CBus.h"
+#include "DpAux.h"
+#include <math.h>
+
+static SpscRing<Sample, SAMPLE_RING_LEN> ring;
+static TaskHandle_t task = nullptr;
+static volatile bool active = true;
+
+// ---- Adaptive rate ----
+// Quiet: one D1 per slot, sensors idle in between. Any |P − zero| ≥ BURST
+// switches back at once; ADAPT_QUIET_MS below QUIET drops the rate again.
+constexpr uint32_t QUIET_SLOT_MS = 1000 / ADAPT_QUIET_HZ;
+static uint32_t calmSinceMs = 0;
+static uint32_t nextSlotMs  = 0;
+
+static void setActive(bool on, uint32_t now_ms){
+  if (on == active) return;
+  active = on;
+  sensorSetPaced(!on);
+  metricCount(on ? CNT_RATE_BURST : CNT_RATE_QUIET);
+  Serial.printf("[rate] %s\n", on ? "burst: full rate" : "quiet: paced");
+  calmSinceMs = now_ms;
+  nextSlotMs  = now_ms;
+}
+
+static void rateUpdate(float P, uint32_t now_ms){
+  if (!adaptiveRate) { setActive(true, now_ms); return; }
+  const float d = fabsf(P - dp_zero);
+  if (d >= ADAPT_BURST_PA) { setActive(true, now_ms); calmSinceMs = now_ms; return; }
+  if (d >= ADAPT_QUIET_PA) calmSinceMs = now_ms;
+  else if (active && now_ms - calmSinceMs >= ADAPT_QUIET_MS) setActive(false, now_ms);
+}
+
+// Quiet cadence: ms until the next slot may start a conversion (0 = go).
+// Conversions already in flight (a D2 follow-up) are always collected.
+static uint32_t quietHoldMs(uint32_t now_ms){
+  if (active || sensorConverting()) return 0;
+  if ((int32_t)(now_ms - nextSlotMs) < 0) return nextSlotMs - now_ms;
+  nextSlotMs += QUIET_SLOT_MS;
+  if ((int32_t)(now_ms - nextSlotMs) >= 0) nextSlotMs = now_ms + QUIET_SLOT_MS;  // fell behind
+  return 0;
+}
+
+static void samplerTask(void*) {
+  // latest env reading, carried on every sample
+  float envP = NAN, envT = NAN, envH = NAN;
+  bool  envHum = false;
+  bool  resume = false;          // first live sample after a replay restarts aggregation
+
+  for (;;) {
+    // Trace replay replaces the sensor; runs as fast as the consumer drains
+    if (traceReplaying()) {
+      Sample s;
+      if (ring.size() >= ring.capacity()) vTaskDelay(1);
+      else if (traceReplayNext(s)) ring.push(s);
+      resume = true;
+      continue;
+    }
+
+    const uint32_t hold = quietHoldMs(millis());
+    if (hold) { busWatch(millis()); vTaskDelay(pdMS_TO_TICKS(hold)); continue; }
+
+    float P, T;
+    dpAuxPoll();
+    if (sensorPoll(P, T)) {
+      Sample s = {};
+      s.t_ms    = millis();
+      s.P_Pa    = P;
+      s.tempP_C = T;
+      sensorLastRaw(s.D1, s.D2);
+      dpAuxTake(s.auxP_Pa);
+      if (resume) { s.flags = SAMPLE_F_RESET; resume = false; }
+      rateUpdate(P, s.t_ms);
+      if (active) s.flags |= SAMPLE_F_ACTIVE;
+
+      float pPa, tC, rH; bool hasH;
+      const uint32_t e0 = micros();
+      if (envRead(pPa, tC, rH, hasH)) { envP = pPa; envT = tC; envH = rH; envHum = hasH; }
+      metricStage(STAGE_ENV, micros() - e0);
+      s.absP_Pa   = envP;
+      s.tempEnv_C = envT;
+      s.RH_pct    = envH;
+      s.envHum    = envHum;
+
+      ring.push(s);   // full → counted as overflow, sample dropped
+    }
+    busWatch(millis());
+
+    // sleep through the rest of the earliest conversion; spin only for sub-tick waits
+    const uint32_t w = min(sensorWaitUs(), dpAuxWaitUs());
+    if (w >= 1000) vTaskDelay(pdMS_TO_TICKS(w / 1000));
+    else if (w)    delayMicroseconds(w);
+  }
+}
+
+void samplerBegin() {
+  if (task) return;
+  xTaskCreatePinnedToCore(samplerTask, "sampler", SAMPLER_STACK, nullptr,
+                          SAMPLER_PRIO, &task, SAMPLER_CORE);
+}
+
+bool samplerPop(Sample &s) { return ring.pop(s); }
+
+bool samplerActive() { return active; }
+
+void samplerStats(SamplerStats &st) {
+  st.produced  = ring.pushed();
+  st.overflows = ring.overflows();
+  st.highWater = ring.highWater();
+  st.depth     = ring.size();
+  st.capacity  = ring.capacity();
+}
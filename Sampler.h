@@ -0,0 +1,23 @@
+#pragma once
+#include "Shared.h"
+
+// Acquisition task: polls the MS5525 state machine and the env sensor on
+// SAMPLER_CORE and pushes timestamped Sample records (raw P, no zero/gating
+// applied) into a lock-free SPSC ring. Call after sensorBegin()/envBegin().
+void samplerBegin();
+
+// Consumer side (app task): pop the next sample; false when the ring is empty.
+bool samplerPop(Sample &s);
+
+struct SamplerStats {
+  uint32_t produced;    // samples pushed since boot
+  uint32_t overflows;   // samples dropped because the ring was full
+  uint32_t highWater;   // max ring occupancy seen
+  uint32_t depth;       // current ring occupancy
+  uint32_t capacity;
+};
+void samplerStats(SamplerStats &st);
+
+// Adaptive rate (adaptiveRate, ADAPT_* in Config.h): true while sampling at
+// the full rate, false on the quiet cadence. Always true when disabled.
+bool samplerActive();
@@ -1,119 +1,238 @@
 #include "SensorMS5525.h"
 #include "Config.h"
 #include "Shared.h"
-#include <Wire.h>
+#include "Metrics.h"
+#include "MS5525Dev.h"
+#include "I2CBus.h"
+#include "DpAux.h"
 
-static uint16_t Cprom[8];
+static_assert(MS5525_OSR_COUNT == MS5525_OSR_STEPS, "OSR table size");
 
-static bool i2cWrite(uint8_t b, bool stop=true){
-  Wire.beginTransmission(MS5525_ADDR);
-  Wire.write(b);
-  return Wire.endTransmission(stop)==0;
+// The primary ΔP sensor: MS5525_ADDR on Wire
+static WirePort  port(0);
+static Ms5525Dev dev;
+
+// sensorPoll() (sampler task) and sensorReadPT() (zeroing) share the state machine
+static SemaphoreHandle_t lock = nullptr;
+struct LockGuard {
+  LockGuard()  { if (lock) xSemaphoreTake(lock, portMAX_DELAY); }
+  ~LockGuard() { if (lock) xSemaphoreGive(lock); }
+};
+
+bool sensorStart(bool temperature) {
+  if (dev.start(temperature, micros())) return true;
+  metricCount(CNT_CONV_FAIL);
+  return false;
 }
 
-static bool readPROM(){
-  constexpr uint8_t CMD_PROM = 0xA0;
-  for (int i=0;i<8;i++){
-    Wire.beginTransmission(MS5525_ADDR);
-    Wire.write(CMD_PROM + 2*i);
-    if (Wire.endTransmission(false)!=0) return false;
-    if (Wire.requestFrom((uint8_t)MS5525_ADDR,(uint8_t)2,true)!=2) return false;
-    Cprom[i] = (uint16_t(Wire.read())<<8) | Wire.read();
-  }
-  return true;
+bool sensorReady() { return dev.ready(micros()); }
+
+bool sensorCollect(uint32_t &adc) {
+  if (dev.collect(adc)) return true;
+  metricCount(CNT_CONV_FAIL);
+  return false;
 }
 
-// small helper to tolerate a transient NACK
-static bool convert(uint8_t opcode, uint32_t &adc) {
-  constexpr uint8_t CMD_ADC = 0x00;
+// blocking convert; small helper to tolerate a transient NACK
+static bool convert(bool temperature, uint32_t &adc) {
   for (int attempt=0; attempt<2; ++attempt) {
-    // Start conversion
-    Wire.beginTransmission(MS5525_ADDR);
-    Wire.write(opcode);
-    if (Wire.endTransmission(true) != 0) continue;
-
-    // OSR4096: worst ~9 ms — be generous
-    delay(12);
-
-    // Repeated START, then read 3 bytes
-    Wire.beginTransmission(MS5525_ADDR);
-    Wire.write(CMD_ADC);
-    if (Wire.endTransmission(false) != 0) continue;
-    if (Wire.requestFrom((uint8_t)MS5525_ADDR, (uint8_t)3, true) != 3) continue;
-
-    uint8_t b0 = Wire.read(), b1 = Wire.read(), b2 = Wire.read();
-    adc = (uint32_t(b0) << 16) | (uint32_t(b1) << 8) | b2;
-    return true;
+    if (attempt) metricCount(CNT_CONV_RETRY);
+    if (!sensorStart(temperature)) continue;
+    delayMicroseconds(dev.waitUs(micros()));
+    if (sensorCollect(adc)) return true;
   }
   return false;
 }
 
-static void compute_fixed(uint32_t D1, uint32_t D2, float &P_Pa, float &T_C){
-  // MS56xx-style integer math (datasheet pattern)
-  // dT   = D2 - C5*2^8   (*** correct reference ***)
-  // TEMP = 2000 + dT*C6 / 2^23      (0.01 °C)
-  // OFF  = C2*2^16 + (C4*dT)/2^7
-  // SENS = C1*2^15 + (C3*dT)/2^8
-  // P    = (D1*SENS/2^21 - OFF)/2^15   (usually hPa)
-
-  int32_t dT   = (int32_t)D2 - ((int32_t)Cprom[5] * 256L);
-  int64_t OFF  = ((int64_t)Cprom[2] << 16) + (((int64_t)Cprom[4] * (int64_t)dT) >> 7);
-  int64_t SENS = ((int64_t)Cprom[1] << 15) + (((int64_t)Cprom[3] * (int64_t)dT) >> 8);
-  int32_t TEMP = 2000 + (int32_t)(((int64_t)dT * (int64_t)Cprom[6]) >> 23);
-
-  // 2nd-order compensation (cold)
-  if (TEMP < 2000) {
-    int32_t t2 = (TEMP - 2000);
-    OFF  -= (5LL * t2 * (int64_t)t2) >> 1;   // /2
-    SENS -= (5LL * t2 * (int64_t)t2) >> 2;   // /4
-  }
+void sensorCompute(const uint16_t C[8], uint32_t D1, uint32_t D2, float &P_Pa, float &T_C){
+  Ms5525Coef k;
+  ms5525Prepare(C, MS5525_P_SCALE, k);
+  ms5525Convert(k, D1, D2, P_Pa, T_C);
+}
 
-  int32_t P_raw_hPa = (int32_t)(((((int64_t)D1 * SENS) >> 21) - OFF) >> 15); // nominally hPa
-  // Configure the scale in Config.h:
-  //   #define MS5525_P_SCALE 100.0f   // if P_raw is hPa → Pa
-  //   #define MS5525_P_SCALE   1.0f   // if your variant already yields Pa
-#ifndef MS5525_P_SCALE
-#define MS5525_P_SCALE 100.0f
-#endif
+void sensorProm(uint16_t C[8]){ memcpy(C, dev.prom(), 8 * sizeof(uint16_t)); }
 
-  P_Pa = (float)P_raw_hPa * MS5525_P_SCALE;
-  T_C  = (float)TEMP / 100.0f;
+bool sensorVerify(){
+  LockGuard g;
+  if (dev.converting() != Ms5525Dev::Conv::Idle) return true;   // never disturb a conversion
+  uint16_t C[8];
+  return dev.readProm(C) && !memcmp(C, dev.prom(), sizeof(C));
 }
 
 void sensorBegin() {
-  Wire.begin(SDA_PIN, SCL_PIN, I2C_HZ);
-  Wire.setTimeOut(50);
-  delay(20);
+  if (!lock) lock = xSemaphoreCreateMutex();
+  delay(20);                         // bus is up (busBegin)
 
-  constexpr uint8_t CMD_RESET = 0x1E;
-  if (!i2cWrite(CMD_RESET)) { Serial.println("ERR reset"); while(1){} }
+  dev.attach(&port, MS5525_ADDR);     // OSR / temp cadence already set by loadSettings()
+  if (!dev.reset()) { Serial.println("ERR reset"); while(1){} }
   delay(3);
 
-  if (!readPROM()) { Serial.println("ERR PROM"); while(1){} }
+  if (!dev.loadProm(MS5525_P_SCALE)) { Serial.println("ERR PROM"); while(1){} }
   Serial.println("PROM:");
-  for (int i=0;i<8;i++) Serial.printf(" C[%d]=0x%04X\n", i, Cprom[i]);
+  for (int i=0;i<8;i++) Serial.printf(" C[%d]=0x%04X\n", i, dev.prom()[i]);
 }
 
-bool sensorReadPT(float &P_Pa, float &T_C) {
-  constexpr uint8_t OPC_D1=0x48;  // pressure OSR4096
-  constexpr uint8_t OPC_D2=0x58;  // temp    OSR4096
-  uint32_t D1=0, D2=0;
-  if (!convert(OPC_D1, D1)) return false;
-  if (!convert(OPC_D2, D2)) return false;
-  compute_fixed(D1, D2, P_Pa, T_C);
-
-  // debug once per second
+// debug once per second
+static void debugPrint(uint32_t D1, uint32_t D2, float P_Pa, float T_C) {
   static uint32_t next = 0;
   uint32_t now = millis();
-  if (now - next < (uint32_t)0x80000000UL) { /* keep unsigned rollover sane */ }
-  if (now >= next) {
+  if ((int32_t)(now - next) >= 0) {
     next = now + 1000;
     Serial.printf("[MS5525] D1=%lu D2=%lu  T=%.2f C  P=%.1f Pa\n",
                   (unsigned long)D1, (unsigned long)D2, (double)T_C, (double)P_Pa);
   }
+}
+
+bool sensorReadPT(float &P_Pa, float &T_C) {
+  LockGuard g;
+  // finish (and drop) a conversion the state machine may have in flight
+  if (dev.converting() != Ms5525Dev::Conv::Idle) {
+    while (!sensorReady()) delayMicroseconds(200);
+    uint32_t discard; sensorCollect(discard);
+  }
+  uint32_t D1=0, D2=0;
+  if (!convert(false, D1)) return false;
+  if (!convert(true,  D2)) return false;
+  dev.setRaw(D1, D2);
+  dev.convert(P_Pa, T_C);
+  debugPrint(D1, D2, P_Pa, T_C);
+  return true;
+}
+
+// ---- profile sweep state (statsAdd() steps it under the driver lock) ----
+static bool    profRunning = false;
+static uint8_t profStep = 0, profSavedP = 0;
+
+// Acquisition settings apply to every ΔP sensor (primary + DP_AUX). Called
+// from the HTTP task while the sampler polls: under the driver lock.
+void sensorSetTempEvery(uint8_t n) {
+  LockGuard g;
+  dev.setTempEvery(n);
+  dpAuxSetup(dev.osrP(), dev.osrT(), dev.tempEvery());
+}
+uint8_t sensorTempEvery()             { return dev.tempEvery(); }
+
+// During a profile sweep the device runs the sweep's OSR step: a new
+// setting would be overwritten when the sweep restores profSavedP
+void sensorSetOsr(uint8_t p, uint8_t t) {
+  LockGuard g;
+  if (profRunning) return;
+  dev.setOsr(p, t);
+  dpAuxSetup(dev.osrP(), dev.osrT(), dev.tempEvery());
+}
+// The configured OSR (not the sweep's current step) — what gets persisted
+uint8_t  sensorOsrP()                 { return profRunning ? profSavedP : dev.osrP(); }
+uint8_t  sensorOsrT()                 { return dev.osrT(); }
+uint16_t sensorOsrRatio(uint8_t osr)  { return (uint16_t)(256u << min<uint8_t>(osr, MS5525_OSR_COUNT-1)); }
+uint32_t sensorConvUs(uint8_t osr)    { return ms5525ConvUs(osr); }
+
+uint8_t sensorOsrFromRatio(uint32_t ratio) {
+  uint8_t osr = 0;
+  while (osr < MS5525_OSR_COUNT-1 && (256u << osr) < ratio) osr++;
+  return osr;
+}
+
+// ---- rate / noise measurement ----
+// Welford running mean/variance of P; noise = sample std-dev over the window
+struct RateNoise {
+  uint32_t t0 = 0, n = 0;
+  double   mean = 0, m2 = 0;
+  void clear(uint32_t now) { t0 = now; n = 0; mean = m2 = 0; }
+  void add(double x) { n++; double d = x - mean; mean += d / n; m2 += d * (x - mean); }
+  float sps(uint32_t now) const { uint32_t dt = now - t0; return dt ? n * 1000.0f / dt : 0.0f; }
+  float rms() const { return n > 1 ? (float)sqrt(m2 / (n - 1)) : 0.0f; }
+};
+
+static RateNoise live;                 // current settings, 1 s windows
+static float     liveSps = 0, liveNoise = 0;
+
+static OsrProfile profRes[MS5525_OSR_COUNT];
+static RateNoise  prof;
+static uint16_t   profStepMs = 0;
+static bool       profSkip = false;    // first D1 of a step was started at the old OSR
+
+void sensorRateNoise(float &sps, float &noise_Pa) { sps = liveSps; noise_Pa = liveNoise; }
+
+bool sensorProfileStart(uint16_t msPerStep) {
+  LockGuard g;
+  if (profRunning) return false;
+  profRunning = true;
+  profStep    = 0;
+  profStepMs  = max<uint16_t>(msPerStep, 200);
+  profSavedP  = dev.osrP();
+  profSkip    = true;
+  memset(profRes, 0, sizeof(profRes));
+  dev.setOsr(0, dev.osrT());
+  return true;
+}
+
+bool sensorProfileRunning() { return profRunning; }
+
+uint8_t sensorProfileResults(OsrProfile* out, uint8_t maxN) {
+  uint8_t n = 0;
+  for (uint8_t i=0; i<MS5525_OSR_COUNT && n<maxN; i++)
+    if (profRes[i].samples) out[n++] = profRes[i];
+  return n;
+}
+
+static void statsAdd(float P_Pa) {
+  const uint32_t now = millis();
+  if (live.t0 == 0) live.clear(now);
+  live.add(P_Pa);
+  if (now - live.t0 >= 1000) {
+    liveSps = live.sps(now); liveNoise = live.rms();
+    live.clear(now);
+  }
+
+  if (!profRunning) return;
+  if (profSkip) { profSkip = false; prof.clear(now); return; }
+  prof.add(P_Pa);
+  if (now - prof.t0 < profStepMs) return;
+
+  OsrProfile &r = profRes[profStep];
+  r.osr      = sensorOsrRatio(profStep);
+  r.conv_us  = ms5525ConvUs(profStep);
+  r.sps      = prof.sps(now);
+  r.noise_Pa = prof.rms();
+  r.samples  = prof.n;
+  Serial.printf("[MS5525] profile OSR%u: %.1f S/s, noise %.3f Pa RMS\n",
+                (unsigned)r.osr, (double)r.sps, (double)r.noise_Pa);
+
+  if (++profStep >= MS5525_OSR_COUNT) { profRunning = false; dev.setOsr(profSavedP, dev.osrT()); }
+  else                                { dev.setOsr(profStep, dev.osrT()); profSkip = true; }
+}
+
+uint32_t sensorWaitUs() { return dev.waitUs(micros()); }
+bool     sensorConverting() { return dev.converting() != Ms5525Dev::Conv::Idle; }
+
+void sensorSetPaced(bool on) {
+  LockGuard g;
+  dev.setPaced(on);
+  dpAuxSetPaced(on);
+}
+
+bool sensorPoll(float &P_Pa, float &T_C) {
+  LockGuard g;
+  const uint32_t now = micros();
+  const bool collecting = dev.ready(now);
+  if (collecting) metricStage(STAGE_CONV, now - dev.startedUs());
+  const Ms5525Dev::Step st = dev.poll(now);
+  // paced (quiet) mode leaves the device idle after a D1 on purpose: only
+  // a lost conversion or a NACKed start is a failure
+  if (st == Ms5525Dev::Step::Fail || st == Ms5525Dev::Step::StartFail) metricCount(CNT_CONV_FAIL);
+  if (st != Ms5525Dev::Step::Pressure) return false;
+
+  dev.convert(P_Pa, T_C);
+  debugPrint(dev.d1(), dev.d2(), P_Pa, T_C);
+  statsAdd(P_Pa);
   return true;
 }
 
+void sensorLastRaw(uint32_t &D1, uint32_t &D2){
+  LockGuard g;
+  D1 = dev.d1(); D2 = dev.d2();
+}
+
 bool doZero(uint16_t ms, uint16_t* outSamples){
   uint32_t t0 = millis(); double acc=0; uint16_t n=0;
   while ((uint32_t)(millis() - t0) < ms) {
@@ -124,4 +243,52 @@ bool doZero(uint16_t ms, uint16_t* outSamples){
   if (outSamples) *outSamples = n;
   if (n > 5) { dp_zero = (float)(acc/n); return true; }
   return false;
+}
+
+// ---- background zeroing job (fed from the app task) ----
+static volatile bool zRunning = false;
+static bool     zDone = false, zOk = false, zStarted = false;
+static uint16_t zMs = 0, zN = 0;
+static uint32_t zT0 = 0, zLastT = 0;
+static double   zAcc = 0;
+static double   zAuxAcc[DP_AUX_MAX];
+static uint16_t zAuxN[DP_AUX_MAX];
+
+bool zeroStart(uint16_t ms) {
+  if (zRunning) return false;
+  zMs = max<uint16_t>(ms, 200);
+  zN = 0; zAcc = 0; zStarted = false; zLastT = 0;
+  for (uint8_t i = 0; i < DP_AUX_MAX; i++) { zAuxAcc[i] = 0; zAuxN[i] = 0; }
+  zRunning = true;
+  return true;
+}
+
+bool zeroFeed(uint32_t t_ms, float P_Pa, const float* auxP) {
+  if (!zRunning) return false;
+  if (!zStarted) { zStarted = true; zT0 = t_ms; }
+  zLastT = t_ms;
+  if ((uint32_t)(t_ms - zT0) < zMs) {
+    zAcc += P_Pa;
+    if (zN < 0xFFFF) zN++;
+    for (uint8_t i = 0; auxP && i < DP_AUX_MAX; i++)
+      if (!isnan(auxP[i]) && zAuxN[i] < 0xFFFF) { zAuxAcc[i] += auxP[i]; zAuxN[i]++; }
+    return false;
+  }
+  zOk = (zN > 5);
+  if (zOk) dp_zero = (float)(zAcc / zN);   // single store, same task as the reader
+  for (uint8_t i = 0; zOk && i < DP_AUX_MAX; i++)
+    if (zAuxN[i] > 5) dpAuxZero[i] = (float)(zAuxAcc[i] / zAuxN[i]);
+  zDone = true;
+  zRunning = false;
+  return zOk;
+}
+
+void zeroStatus(ZeroStatus &st) {
+  st.running  = zRunning;
+  st.done     = zDone;
+  st.ok       = zOk;
+  st.samples  = zN;
+  st.progress = !zRunning ? (zDone ? 100 : 0)
+              : !zStarted ? 0
+              : (uint8_t)min<uint32_t>(99, (uint32_t)(zLastT - zT0) * 100 / zMs);
 }
\ No newline at end of file
@@ -1,12 +1,94 @@
 #pragma once
 #include <Arduino.h>
+#include "Config.h"
 
-// Initialize I2C and sensor (reset + PROM)
+// Initialize the sensor (reset + PROM); the bus is started by busBegin()
 void sensorBegin();
 
+// Bus check for speed tuning: re-read the PROM and compare with the boot copy
+bool sensorVerify();
+
 // Read one pressure/temperature pair (Pa, °C). Returns true on success.
+// Blocking (waits out both conversions) — use sensorPoll() from loop().
 bool sensorReadPT(float &P_Pa, float &T_C);
 
+// ---- Non-blocking driver ----
+// Low level: start a D1 (pressure) or D2 (temperature) conversion, poll until
+// the conversion time has elapsed, then collect the 24-bit ADC word.
+bool sensorStart(bool temperature);
+bool sensorReady();
+bool sensorCollect(uint32_t &adc);
+
+// State machine on top of the above: call as often as possible. Returns true
+// when a fresh pressure sample is ready (T_C is the latest D2, reused between
+// temperature refreshes). Never waits for a conversion.
+bool sensorPoll(float &P_Pa, float &T_C);
+
+// Raw ADC words behind the last sensorPoll() sample (for trace recording)
+void sensorLastRaw(uint32_t &D1, uint32_t &D2);
+
+// PROM coefficients and the D1/D2 → Pa/°C conversion with any PROM set
+// (trace replay converts recorded words with the recording device's PROM)
+void sensorProm(uint16_t C[8]);
+void sensorCompute(const uint16_t C[8], uint32_t D1, uint32_t D2, float &P_Pa, float &T_C);
+
+// µs until the in-flight conversion is ready (0 = collect now). When idle
+// (start NACKed) returns 1000 so the caller backs off a tick before retrying.
+uint32_t sensorWaitUs();
+bool     sensorConverting();
+
+// Adaptive rate (Sampler.cpp): paced → no back-to-back D1 conversions; each
+// sensorPoll() on an idle sensor starts one. Applies to the DP_AUX sensors too.
+void     sensorSetPaced(bool on);
+
+// Refresh D2 once every n pressure conversions (1 = every sample).
+void    sensorSetTempEvery(uint8_t n);
+uint8_t sensorTempEvery();
+
+// ---- Oversampling ----
+// osr index 0..4 → OSR256, 512, 1024, 2048, 4096. Separate choice for D1 (pressure)
+// and D2 (temperature); wait time follows the datasheet conversion-time table.
+void     sensorSetOsr(uint8_t osrP, uint8_t osrT);
+uint8_t  sensorOsrP();
+uint8_t  sensorOsrT();
+uint16_t sensorOsrRatio(uint8_t osr);        // 256…4096
+uint8_t  sensorOsrFromRatio(uint32_t ratio); // nearest index at or above ratio
+uint32_t sensorConvUs(uint8_t osr);
+
+// Measured pressure samples/s and noise (std-dev of P, Pa) over the last second
+void sensorRateNoise(float &sps, float &noise_Pa);
+
+// Profile sweep: runs each pressure OSR for msPerStep through sensorPoll(),
+// then restores the configured OSR. Keep the ports in still air while it runs.
+struct OsrProfile {
+  uint16_t osr;        // ratio (256…4096)
+  uint32_t conv_us;    // datasheet max conversion time
+  float    sps;        // measured pressure samples/s
+  float    noise_Pa;   // RMS noise of P over the step
+  uint32_t samples;
+};
+bool    sensorProfileStart(uint16_t msPerStep = MS5525_PROFILE_MS);
+bool    sensorProfileRunning();
+uint8_t sensorProfileResults(OsrProfile* out, uint8_t maxN);
+
 // Zeroing helper: average ΔP with both ports open. Returns ok, writes dp_zero,
-// optionally returns sample count via outSamples.
-bool doZero(uint16_t ms = 2000, uint16_t* outSamples = nullptr);
\ No newline at end of file
+// optionally returns sample count via outSamples. Blocking — setup() only.
+bool doZero(uint16_t ms = 2000, uint16_t* outSamples = nullptr);
+
+// ---- Background zeroing ----
+// zeroStart() arms a job; the app task feeds it every sample it consumes.
+// dp_zero is written once, by zeroFeed(), when the window closes.
+bool zeroStart(uint16_t ms = 2000);
+
+// Returns true exactly once, on the sample that completed a successful job.
+// auxP (DP_AUX_MAX entries, NaN = no reading) zeroes the extra ΔP sensors too.
+bool zeroFeed(uint32_t t_ms, float P_Pa, const float* auxP = nullptr);
+
+struct ZeroStatus {
+  bool     running;
+  bool     done;       // a job has finished since boot
+  bool     ok;         // last finished job applied a new dp_zero
+  uint8_t  progress;   // 0..100 %
+  uint16_t samples;
+};
+void zeroStatus(ZeroStatus &st);
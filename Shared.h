@@ -1,6 +1,7 @@
 #pragma once
 #include <Arduino.h>
 #include <Preferences.h>
+#include "Config.h"
 
 class WebServer;
 
@@ -17,6 +18,35 @@ struct Sample {
   float    tempEnv_C;  // environment sensor temperature (BME/BMP)
   float    absP_Pa;    // environment absolute pressure (Pa)
   float    RH_pct;     // environment relative humidity (% or 0 if N/A)
+  // Display smoothing (10-pt running means, advanced once per sample)
+  float    dp_s;
+  float    tc_s;
+  // Raw acquisition (filled by the sampler task, before zero/invert)
+  float    P_Pa;       // MS5525 compensated pressure
+  bool     envHum;     // env reading includes humidity
+  uint32_t D1, D2;     // MS5525 ADC words behind P_Pa (trace recording)
+  float    auxP_Pa[DP_AUX_MAX];   // extra ΔP sensors: mean P since the last sample (NaN = none)
+  float    auxDp_Pa[DP_AUX_MAX];  // … zeroed/inverted by the app task
+  uint8_t  flags;      // SAMPLE_F_*
+};
+
+enum : uint8_t {
+  SAMPLE_F_REPLAY = 1,   // fed from a trace, not the sensor
+  SAMPLE_F_RESET  = 2,   // first replayed sample: restart the aggregation state
+  SAMPLE_F_ACTIVE = 4,   // sampled at the full rate (adaptive scheduler bursting)
+};
+
+// Counters of the aggregation pipeline (processSample), app task only
+struct PipeStats {
+  uint32_t samples;    // samples processed
+  uint32_t bins;       // 1 Hz bins closed
+  uint32_t nudges;     // quiet auto-zero nudges applied
+  uint32_t gateOn;     // speed display gate opened
+  uint32_t gateOff;    // … and closed
+  // Detection latency: raw |ΔP| ≥ AIR_GATE_ON_PA → gate open
+  uint32_t onsets;     // onsets that opened the gate
+  uint32_t latSumMs, latMaxMs;
+  uint32_t missed;     // onsets that fell back below AIR_GATE_OFF_PA first
 };
 
 // Globals (defined in .ino)
@@ -25,7 +55,15 @@ extern Sample   lastS;
 extern float    dp_zero;
 extern float    rho;
 extern bool     invertDP;
+extern float    dpAuxZero[DP_AUX_MAX];    // per extra ΔP sensor (DpAux.h)
+extern bool     dpAuxInvert[DP_AUX_MAX];
 extern uint32_t logEveryMs;
+extern uint8_t  logFormat;    // LOG_FMT_CSV / LOG_FMT_BIN (Logging.h)
+extern uint32_t logFlushMs;   // RAM row buffer → flash interval
+extern uint8_t  logKeepPct;   // retention budget, % of the FS (Storage.h)
+extern bool     adaptiveRate; // low rate while quiet, full rate on flow (Sampler.h)
+extern uint16_t airFilterMs;  // airspeed filter τ (AirFilter.h)
+extern uint32_t liveFrameMs;  // live stream batch period
 extern uint32_t bootCounter;
 extern bool     loggingOn;
 
@@ -36,6 +74,16 @@ extern float    envRH;
 extern bool     envHasHum;
 
 extern bool     g_showSpeed;
+extern PipeStats pipeStats;
+
+// App state (the globals above, logging, history, traces, live stream) is
+// owned by the app task; HTTP handlers run in their own task and take this
+// lock for the duration of a handler (WebUI.cpp)
+extern SemaphoreHandle_t appMutex;
+struct AppLock {
+  AppLock()  { xSemaphoreTake(appMutex, portMAX_DELAY); }
+  ~AppLock() { xSemaphoreGive(appMutex); }
+};
 
 extern long long g_timeOffsetMs; // epoch_ms - millis()
 extern int       g_tzOffsetMin;  // minutes west of UTC
\ No newline at end of file
@@ -0,0 +1,75 @@
+#include "Snapshot.h"
+#include "Config.h"
+#include "Logging.h"
+#include "JsonWriter.h"
+#include <atomic>
+#include <math.h>
+
+struct Slot {
+  std::atomic<uint32_t> seq{0};        // odd while being written
+  uint32_t version;
+  uint16_t len;
+  char     buf[SNAPSHOT_BUF];
+};
+static Slot                 slots[2];
+static std::atomic<uint8_t> latest{0};
+static uint32_t             version = 0;
+
+size_t snapshotFormat(const Sample& l, const SnapshotEnv& e, uint32_t version, char* buf, size_t cap) {
+  const unsigned long long ts = (unsigned long long)e.timeOffsetMs + l.t_ms;
+  JsonWriter j(buf, cap);
+  j.obj()
+   .kvu("v",    version)
+   .kvu("t",    l.t_ms)                                    // legacy ms
+   .kvu("ts",   ts)
+   .kvf("dp",   l.dp_Pa, 4)
+   .kvf("tc",   l.temp_C, 3)
+   .kvf("va",   l.Va_mps, 4)
+   .kvf("rho",  e.rho, 4)
+   .kvf("ap",   isnan(e.envP_Pa) ? 0 : e.envP_Pa, 1)
+   .kvf("at",   isnan(e.envT_C)  ? 0 : e.envT_C, 2)
+   .kvf("ah",   isnan(e.envRH)   ? 0 : e.envRH, 1)
+   .kvb("hasH", e.envHasHum)
+   .kvf("dp_s", l.dp_s, 4)
+   .kvf("tc_s", l.tc_s, 4)
+   .kvb("logging", e.logging)
+   .kvs("curFile", e.curFile);
+  if (DP_AUX_N) {                                          // extra ΔP sensors
+    j.arr("dpx");
+    for (uint8_t i = 0; i < DP_AUX_N; i++) j.kvf(nullptr, l.auxDp_Pa[i], 4);
+    j.end();
+  }
+  j.end();
+  return j.length();
+}
+
+void snapshotPublish() {
+  const uint8_t k = latest.load(std::memory_order_relaxed) ^ 1;
+  Slot& s = slots[k];
+  s.seq.fetch_add(1, std::memory_order_acq_rel);          // → odd
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const SnapshotEnv e{ g_timeOffsetMs, rho, envP_Pa, envT_C, envRH, envHasHum, loggingOn, currentLogNameC() };
+  s.version = ++version;
+  s.len     = (uint16_t)snapshotFormat(lastS, e, version, s.buf, sizeof(s.buf));
+
+  std::atomic_thread_fence(std::memory_order_release);
+  s.seq.fetch_add(1, std::memory_order_release);          // → even
+  latest.store(k, std::memory_order_release);
+}
+
+size_t snapshotCopy(char* out, size_t cap, uint32_t* ver) {
+  for (int tries = 0; tries < 8; tries++) {
+    const Slot& s = slots[latest.load(std::memory_order_acquire)];
+    const uint32_t a = s.seq.load(std::memory_order_acquire);
+    if (a & 1) continue;                                   // writer inside: retry
+    size_t n = min<size_t>(s.len, cap);
+    memcpy(out, s.buf, n);
+    const uint32_t v = s.version;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (s.seq.load(std::memory_order_relaxed) != a) continue;
+    if (ver) *ver = v;
+    return n;
+  }
+  return 0;
+}
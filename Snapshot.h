@@ -0,0 +1,23 @@
+#pragma once
+#include "Shared.h"
+
+// Pre-serialized /api/sample document, published once per processed sample
+// (app task) and copied out by any number of HTTP clients. Seqlock over a
+// double buffer: no heap, no locks, readers never see a torn document.
+
+// Writer: rebuild from lastS + env/logging globals and bump the version
+void snapshotPublish();
+
+// State besides the sample that goes into the document
+struct SnapshotEnv {
+  long long   timeOffsetMs;   // g_timeOffsetMs
+  float       rho, envP_Pa, envT_C, envRH;
+  bool        envHasHum, logging;
+  const char* curFile;
+};
+// The serializer behind snapshotPublish(): document `version` into buf,
+// touching no shared state (also what /api/bench times); returns its length
+size_t snapshotFormat(const Sample& l, const SnapshotEnv& e, uint32_t version, char* buf, size_t cap);
+
+// Reader: copy the latest document into out; returns its length (0 on failure)
+size_t snapshotCopy(char* out, size_t cap, uint32_t* version = nullptr);
@@ -0,0 +1,123 @@
+#include "Storage.h"
+#include "Config.h"
+#include "Shared.h"
+#include "FlashFS.h"
+#include "Logging.h"
+#include "LogIndex.h"
+
+constexpr size_t SEG_MIN_BYTES = 16 * 1024;
+
+static uint32_t lastCheckMs = 0;
+static uint32_t deletedSegs = 0;
+static bool     squeeze     = false;
+
+// Pinned files: one slot per queued or running export
+struct Pin { char path[48]; uint8_t refs; };
+static Pin          pins[2 * EXPORT_WORKERS];
+static portMUX_TYPE pinMux = portMUX_INITIALIZER_UNLOCKED;
+
+bool storagePin(const char* path){
+  if (strlen(path) >= sizeof(pins[0].path)) return false;
+  bool ok = false;
+  portENTER_CRITICAL(&pinMux);
+  Pin* slot = nullptr;
+  for (Pin& p : pins) {
+    if (p.refs && !strcmp(p.path, path)) { p.refs++; ok = true; break; }
+    if (!p.refs && !slot) slot = &p;
+  }
+  if (!ok && slot) { strcpy(slot->path, path); slot->refs = 1; ok = true; }
+  portEXIT_CRITICAL(&pinMux);
+  return ok;
+}
+
+void storageUnpin(const char* path){
+  portENTER_CRITICAL(&pinMux);
+  for (Pin& p : pins)
+    if (p.refs && !strcmp(p.path, path)) { p.refs--; break; }
+  portEXIT_CRITICAL(&pinMux);
+}
+
+bool storagePinned(const char* path){
+  bool hit = false;
+  portENTER_CRITICAL(&pinMux);
+  for (const Pin& p : pins) hit |= p.refs && !strcmp(p.path, path);
+  portEXIT_CRITICAL(&pinMux);
+  return hit;
+}
+
+bool storageBegin(){
+  if (FLASHFS.begin(true)) return true;
+  Serial.println("[storage] mount failed");
+  return false;
+}
+
+static size_t budget(){ return (size_t)((uint64_t)FLASHFS.totalBytes() * logKeepPct / 100); }
+static size_t freeBytes(){
+  const size_t t = FLASHFS.totalBytes(), u = FLASHFS.usedBytes();
+  return t > u ? t - u : 0;
+}
+
+size_t storageSegmentBytes(){
+  return min<size_t>(LOG_SEG_BYTES, max<size_t>(budget() / 4, SEG_MIN_BYTES));
+}
+
+// Log segments sort by (boot, millis) from the name; /current.* (fallback
+// name, no timestamp) counts as oldest
+static bool segmentKey(const char* name, uint64_t& key){
+  if (*name == '/') name++;
+  unsigned long boot, ms;
+  if (sscanf(name, "log_%lu_%lu.", &boot, &ms) == 2) { key = ((uint64_t)boot << 32) | ms; return true; }
+  if (!strncmp(name, "current.", 8) && strcmp(name + 8, "idx")) { key = 0; return true; }
+  return false;
+}
+
+// Remove the oldest closed segment that no export is reading, and its
+// index; false if none is left
+static bool deleteOldest(){
+  const char* active = currentLogNameC();
+  String   oldest;
+  uint64_t oldestKey = UINT64_MAX;
+  File root = FLASHFS.open("/");
+  for (File f = root.openNextFile(); f; f = root.openNextFile()) {
+    const char* name = f.name();
+    uint64_t key;
+    if (!segmentKey(name, key) || key >= oldestKey) continue;
+    const String path = (*name == '/') ? String(name) : "/" + String(name);
+    if (path == active || path.endsWith(".idx") || storagePinned(path.c_str())) continue;
+    oldest = path; oldestKey = key;
+  }
+  root.close();
+  if (!oldest.length()) return false;
+
+  FLASHFS.remove(oldest);
+  const String ix = logIndexPath(oldest);
+  if (FLASHFS.exists(ix)) FLASHFS.remove(ix);
+  deletedSegs++;
+  Serial.printf("[storage] retention: deleted %s\n", oldest.c_str());
+  return true;
+}
+
+static bool overBudget(size_t want){
+  return FLASHFS.usedBytes() + want > budget() || freeBytes() < want + LOG_RESERVE_BYTES;
+}
+
+bool storageMakeRoom(size_t bytes){
+  while (overBudget(bytes)) if (!deleteOldest()) return false;
+  return true;
+}
+
+void storageSqueeze(){ squeeze = true; }
+
+void storageTick(uint32_t now_ms){
+  if (now_ms - lastCheckMs < STORAGE_CHECK_MS) return;
+  lastCheckMs = now_ms;
+  // one delete per check: keeps each step short (SPIFFS removes can take ms)
+  if (squeeze || overBudget(0)) { deleteOldest(); squeeze = false; }
+}
+
+void storageStats(StorageStats &st){
+  st.total   = FLASHFS.totalBytes();
+  st.used    = FLASHFS.usedBytes();
+  st.budget  = budget();
+  st.deleted = deletedSegs;
+}
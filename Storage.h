@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+
+// Log storage manager on the flash FS (FlashFS.h).
+//  - rotation: Logging closes a segment at LOG_SEG_BYTES or LOG_SEG_MS and
+//    continues in a new /log_<boot>_<millis> file (same session, new header)
+//  - retention: logs may use logKeepPct % of the FS; storageTick() deletes
+//    the oldest segment (+ .idx) in the background while over budget
+//  - reservation: before a segment is opened, room for a whole segment plus
+//    LOG_RESERVE_BYTES is made, so appends don't hit a full FS mid-segment
+// Only /log_* and /current.* files are ever deleted, never the open segment
+// or a file an export is streaming (pinned).
+
+// Mount (formatting on failure). Call first in setup().
+bool   storageBegin();
+
+// App task: one retention step at most every STORAGE_CHECK_MS
+void   storageTick(uint32_t now_ms);
+
+// Size cap of the next segment: LOG_SEG_BYTES, smaller on a small budget
+size_t storageSegmentBytes();
+
+// Delete oldest segments until `bytes` + LOG_RESERVE_BYTES are free and the
+// budget allows it; false if there was nothing left to delete
+bool   storageMakeRoom(size_t bytes);
+
+// Appends failed (FS full): run retention on the next tick regardless of budget
+void   storageSqueeze();
+
+// Files being exported (/download, queued or streaming): retention skips
+// them and /api/delete refuses. Pin before handing the job to a worker,
+// unpin when it is done; pins nest. Any task.
+bool   storagePin(const char* path);      // false → pin table full
+void   storageUnpin(const char* path);
+bool   storagePinned(const char* path);
+
+struct StorageStats {
+  uint32_t total, used;
+  uint32_t budget;      // bytes logs may occupy (logKeepPct)
+  uint32_t deleted;     // segments removed by retention since boot
+};
+void   storageStats(StorageStats &st);
@@ -0,0 +1,121 @@
+#pragma once
+// Fixed-memory streaming statistics for the 1 Hz aggregator.
+// Quantiles are exact while a bin holds ≤ N samples (kept sorted by
+// insertion in a fixed array); beyond that the P² estimator (Jain &
+// Chlamtac, 1985 — five markers, O(1) per sample) that runs alongside takes
+// over. Welford mean/variance. No heap, no Arduino dependencies.
+#include <math.h>
+#include <stdint.h>
+
+class P2Quantile {
+public:
+  void reset(float p) {
+    p_ = p; n_ = 0;
+    dn_[0] = 0; dn_[1] = p / 2; dn_[2] = p; dn_[3] = (1 + p) / 2; dn_[4] = 1;
+  }
+
+  void add(float x) {
+    if (n_ < 5) {                       // warm-up: keep the first five sorted
+      int i = n_++;
+      while (i > 0 && q_[i - 1] > x) { q_[i] = q_[i - 1]; i--; }
+      q_[i] = x;
+      if (n_ == 5) {
+        for (int k = 0; k < 5; k++) pos_[k] = k + 1;
+        np_[0] = 1; np_[1] = 1 + 2 * p_; np_[2] = 1 + 4 * p_; np_[3] = 3 + 2 * p_; np_[4] = 5;
+      }
+      return;
+    }
+    n_++;
+
+    int k;
+    if      (x < q_[0])  { q_[0] = x; k = 0; }
+    else if (x < q_[1])  k = 0;
+    else if (x < q_[2])  k = 1;
+    else if (x < q_[3])  k = 2;
+    else if (x <= q_[4]) k = 3;
+    else                 { q_[4] = x; k = 3; }
+
+    for (int i = k + 1; i < 5; i++) pos_[i]++;
+    for (int i = 0; i < 5; i++) np_[i] += dn_[i];
+
+    for (int i = 1; i <= 3; i++) {
+      const float d = np_[i] - pos_[i];
+      if ((d >= 1 && pos_[i + 1] - pos_[i] > 1) || (d <= -1 && pos_[i - 1] - pos_[i] < -1)) {
+        const int s = d > 0 ? 1 : -1;
+        float qp = parabolic(i, s);
+        if (!(q_[i - 1] < qp && qp < q_[i + 1]))
+          qp = q_[i] + s * (q_[i + s] - q_[i]) / (pos_[i + s] - pos_[i]);
+        q_[i] = qp;
+        pos_[i] += s;
+      }
+    }
+  }
+
+  // Current estimate (NaN when empty)
+  float value() const {
+    if (n_ == 0) return NAN;
+    if (n_ <= 5) {                      // exact nearest-rank on the sorted warm-up
+      int r = (int)lroundf(p_ * (n_ - 1));
+      return q_[r];
+    }
+    return q_[2];
+  }
+
+  uint32_t count() const { return n_; }
+
+private:
+  float parabolic(int i, int s) const {
+    const float a = (float)(pos_[i] - pos_[i - 1] + s) * (q_[i + 1] - q_[i]) / (pos_[i + 1] - pos_[i]);
+    const float b = (float)(pos_[i + 1] - pos_[i] - s) * (q_[i] - q_[i - 1]) / (pos_[i] - pos_[i - 1]);
+    return q_[i] + (float)s / (pos_[i + 1] - pos_[i - 1]) * (a + b);
+  }
+
+  float    p_ = 0.5f;
+  uint32_t n_ = 0;
+  float    q_[5];      // marker heights
+  int32_t  pos_[5];    // actual marker positions (1-based)
+  float    np_[5];     // desired positions
+  float    dn_[5];     // desired position increments
+};
+
+// min / max / mean / stddev / p05 / p50 / p95 of one channel
+template <uint16_t N = 64>
+struct StreamStats {
+  uint32_t   n = 0;
+  float      min = NAN, max = NAN;
+  double     mean = 0, m2 = 0;
+  P2Quantile q05, q50, q95;
+  float      sorted[N];         // first N samples, ascending
+
+  void reset() {
+    n = 0; min = max = NAN; mean = m2 = 0;
+    q05.reset(0.05f); q50.reset(0.50f); q95.reset(0.95f);
+  }
+
+  void add(float x) {
+    if (n == 0 || x < min) min = x;
+    if (n == 0 || x > max) max = x;
+    if (n < N) {
+      uint32_t i = n;
+      while (i > 0 && sorted[i - 1] > x) { sorted[i] = sorted[i - 1]; i--; }
+      sorted[i] = x;
+    }
+    n++;
+    const double d = x - mean;
+    mean += d / n;
+    m2   += d * (x - mean);
+    q05.add(x); q50.add(x); q95.add(x);
+  }
+
+  // p in {0.05, 0.5, 0.95}: exact nearest-rank while n ≤ N, else P²
+  float quantile(float p) const {
+    if (n == 0) return NAN;
+    if (n <= N) return sorted[(uint32_t)lroundf(p * (n - 1))];
+    return p < 0.25f ? q05.value() : p > 0.75f ? q95.value() : q50.value();
+  }
+
+  float stddev() const { return n > 1 ? (float)sqrt(m2 / (n - 1)) : 0.0f; }
+  float median() const { return quantile(0.5f); }
+  float p05()    const { return quantile(0.05f); }
+  float p95()    const { return quantile(0.95f); }
+};
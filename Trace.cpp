@@ -0,0 +1,199 @@
+#include "Trace.h"
+#include "Config.h"
+#include "SensorMS5525.h"
+#include "MS5525Comp.h"
+#include "Sampler.h"
+#include "Logging.h"
+#include "FlashFS.h"
+#include <atomic>
+#include <math.h>
+
+// ---------- recording (app task) ----------
+static File     recFile;
+static bool     recOn = false;
+static uint32_t recRows = 0, recStartMs = 0, recForMs = 0;
+static char     recBuf[TRACE_BUF];
+static size_t   recLen = 0;
+
+static void recFlush(){
+  if (recLen && recFile) recFile.write((const uint8_t*)recBuf, recLen);
+  recLen = 0;
+}
+
+bool traceRecordStart(const char* path, uint32_t seconds){
+  if (recOn || traceReplaying()) return false;
+  recFile = FLASHFS.open(path, FILE_WRITE);
+  if (!recFile) return false;
+  uint16_t C[8]; sensorProm(C);
+  recFile.printf("#aerotrace v1 prom=%u,%u,%u,%u,%u,%u,%u,%u zero=%.4f invert=%d\n",
+                 C[0], C[1], C[2], C[3], C[4], C[5], C[6], C[7], (double)dp_zero, invertDP ? 1 : 0);
+  recFile.print("t_ms,D1,D2,envP_Pa,envT_C,envRH_pct,envHum\n");
+  recRows = 0; recLen = 0; recStartMs = 0;
+  recForMs = seconds * 1000UL;
+  recOn = true;
+  Serial.printf("[trace] recording %s for %lus\n", path, (unsigned long)seconds);
+  return true;
+}
+
+void traceRecordStop(){
+  if (!recOn) return;
+  recOn = false;
+  recFlush();
+  recFile.close();
+  Serial.printf("[trace] recorded %lu rows\n", (unsigned long)recRows);
+}
+
+static void recRow(const Sample& s){
+  if (!recRows) recStartMs = s.t_ms;
+  if (recForMs && s.t_ms - recStartMs >= recForMs) { traceRecordStop(); return; }
+  if (recLen + 96 > sizeof(recBuf)) recFlush();
+  int n = snprintf(recBuf + recLen, sizeof(recBuf) - recLen, "%lu,%lu,%lu,%.1f,%.2f,%.1f,%d\n",
+                   (unsigned long)s.t_ms, (unsigned long)s.D1, (unsigned long)s.D2,
+                   (double)s.absP_Pa, (double)s.tempEnv_C, (double)s.RH_pct, s.envHum ? 1 : 0);
+  if (n > 0) { recLen += n; recRows++; }
+}
+
+// ---------- replay ----------
+// Idle → (app) Running → (sampler: EOF/stop) Drained → (app, ring empty) Idle
+enum : uint8_t { R_IDLE, R_RUNNING, R_DRAINED };
+static std::atomic<uint8_t> rState{R_IDLE};
+static std::atomic<bool>    rStopReq{false};
+static File     rFile;                    // read by the sampler task while Running
+static Ms5525Coef rCoef;                  // recording device's PROM, prepared
+static float    rZero = 0;
+static bool     rInvert = false;
+static uint32_t rBase = 0, rT0 = 0, rTLast = 0, rRows = 0;
+static bool     rFirst = false;
+
+// app-side bookkeeping
+static bool      rActive = false;
+static float     liveZero = 0;
+static bool      liveInvert = false;
+static uint32_t  rWallStart = 0;
+static PipeStats pipe0;
+static uint32_t  log0 = 0;
+static TraceStatus res = {};
+
+static bool readLine(File& f, char* buf, size_t cap){
+  size_t n = f.readBytesUntil('\n', buf, cap - 1);
+  if (!n && !f.available()) return false;
+  buf[n] = 0;
+  return true;
+}
+
+bool traceReplayStart(const char* path){
+  if (rState.load() != R_IDLE || recOn) return false;
+  rFile = FLASHFS.open(path, FILE_READ);
+  if (!rFile) return false;
+
+  char line[160];
+  unsigned C[8]; float z = 0; int inv = 0;
+  if (!readLine(rFile, line, sizeof(line)) ||
+      sscanf(line, "#aerotrace v1 prom=%u,%u,%u,%u,%u,%u,%u,%u zero=%f invert=%d",
+             &C[0], &C[1], &C[2], &C[3], &C[4], &C[5], &C[6], &C[7], &z, &inv) != 10 ||
+      !readLine(rFile, line, sizeof(line))) {             // column names
+    rFile.close();
+    return false;
+  }
+  uint16_t prom[8];
+  for (int i = 0; i < 8; i++) prom[i] = (uint16_t)C[i];
+  ms5525Prepare(prom, MS5525_P_SCALE, rCoef);
+  rZero = z; rInvert = inv != 0;
+  rBase = millis(); rRows = 0; rFirst = true;
+  rStopReq = false;
+  rState.store(R_RUNNING, std::memory_order_release);
+  Serial.printf("[trace] replaying %s\n", path);
+  return true;
+}
+
+void traceReplayStop(){ if (rState.load() == R_RUNNING) rStopReq = true; }
+
+bool traceReplaying(){ return rState.load(std::memory_order_acquire) == R_RUNNING; }
+
+bool traceReplayNext(Sample& s){
+  char line[96];
+  for (;;) {
+    if (rStopReq || !readLine(rFile, line, sizeof(line))) {
+      rState.store(R_DRAINED, std::memory_order_release);
+      return false;
+    }
+    char* p = line;
+    const uint32_t t = strtoul(p, &p, 10);
+    s = {};
+    for (float& p : s.auxP_Pa) p = NAN;               // traces carry the primary sensor only
+    s.D1        = strtoul(p + 1, &p, 10);
+    s.D2        = strtoul(p + 1, &p, 10);
+    s.absP_Pa   = strtof(p + 1, &p);
+    s.tempEnv_C = strtof(p + 1, &p);
+    s.RH_pct    = strtof(p + 1, &p);
+    s.envHum    = strtol(p + 1, &p, 10) != 0;
+    if (!s.D1 || !s.D2) continue;                     // blank/garbled row
+
+    if (rFirst) rT0 = t;
+    rTLast = t;
+    s.t_ms  = rBase + (t - rT0);                      // trace clock, rebased
+    s.flags = SAMPLE_F_REPLAY | (rFirst ? SAMPLE_F_RESET : 0);
+    ms5525Convert(rCoef, s.D1, s.D2, s.P_Pa, s.tempP_C);
+    rFirst = false;
+    rRows++;
+    return true;
+  }
+}
+
+// Replay results + restore the live zero/invert (first live sample or drain)
+static void replayFinish(uint32_t now_ms){
+  if (!rActive) return;
+  LogStats ls; logStats(ls);
+  res.done      = true;
+  res.rows      = rRows;
+  res.elapsedMs = now_ms - rWallStart;
+  res.traceMs   = rTLast - rT0;
+  res.bins      = pipeStats.bins    - pipe0.bins;
+  res.logRows   = ls.rows           - log0;
+  res.nudges    = pipeStats.nudges  - pipe0.nudges;
+  res.gateOn    = pipeStats.gateOn  - pipe0.gateOn;
+  res.gateOff   = pipeStats.gateOff - pipe0.gateOff;
+  res.onsets    = pipeStats.onsets  - pipe0.onsets;
+  res.missed    = pipeStats.missed  - pipe0.missed;
+  res.latMeanMs = res.onsets ? (pipeStats.latSumMs - pipe0.latSumMs) / res.onsets : 0;
+  res.latMaxMs  = pipeStats.latMaxMs;
+  res.dpZeroEnd = dp_zero;
+  dp_zero = liveZero; invertDP = liveInvert;
+  rActive = false;
+  Serial.printf("[trace] replay done: %lu rows in %lu ms (%lu ms of trace)\n",
+                (unsigned long)res.rows, (unsigned long)res.elapsedMs, (unsigned long)res.traceMs);
+}
+
+void traceConsume(const Sample& s){
+  if (!(s.flags & SAMPLE_F_REPLAY)) {
+    replayFinish(millis());
+    if (recOn) recRow(s);
+    return;
+  }
+  if (s.flags & SAMPLE_F_RESET) {
+    liveZero = dp_zero; liveInvert = invertDP;
+    dp_zero  = rZero;   invertDP   = rInvert;
+    pipeStats.latMaxMs = 0;            // a max can't be differenced: per replay
+    pipe0 = pipeStats;
+    LogStats ls; logStats(ls); log0 = ls.rows;
+    rWallStart = millis();
+    rActive = true;
+  }
+}
+
+void traceTick(uint32_t now_ms){
+  if (recOn && recLen >= sizeof(recBuf) / 2) recFlush();
+
+  if (rState.load(std::memory_order_acquire) != R_DRAINED) return;
+  rFile.close();                                      // sampler is back on the sensor
+  SamplerStats ss; samplerStats(ss);
+  if (!ss.depth) replayFinish(now_ms);                // else: on the first live sample
+  rState.store(R_IDLE, std::memory_order_release);
+}
+
+void traceStatus(TraceStatus& st){
+  st = res;
+  st.recording = recOn;
+  st.recRows   = recRows;
+  st.replaying = rState.load() != R_IDLE;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "Shared.h"
+
+// Record / replay of raw acquisition traces, so pipeline changes can be
+// checked against a known input without wind-tunnel time.
+//
+// Record: every live sample's MS5525 D1/D2 words + the env reading are
+// written to a CSV trace (header carries the PROM, dp_zero and invert).
+// Replay: the sampler task stops polling the sensor and feeds the trace
+// through sensorCompute() → ring → processSample() as fast as the app task
+// drains it. Aggregation state restarts on the first row and dp_zero is
+// taken from the trace, so the same trace gives the same 1 Hz rows, zero
+// nudges and gate transitions; the live dp_zero is restored afterwards.
+// Step and gust traces give the airspeed detection latency for the current
+// filter τ (onset = first raw |ΔP| ≥ AIR_GATE_ON_PA; a gust shorter than the
+// filter lets ΔP fall back first and counts as missed).
+//
+// Trace file:
+//   #aerotrace v1 prom=<C0>,…,<C7> zero=<Pa> invert=<0|1>
+//   t_ms,D1,D2,envP_Pa,envT_C,envRH_pct,envHum
+//   …one row per pressure sample…
+
+bool traceRecordStart(const char* path, uint32_t seconds);
+void traceRecordStop();
+bool traceReplayStart(const char* path);
+void traceReplayStop();
+
+// App task: call for every popped sample (before processSample), and once per loop
+void traceConsume(const Sample& s);
+void traceTick(uint32_t now_ms);
+
+// Sampler task: true while a replay owns the sample source
+bool traceReplaying();
+// Sampler task: next replayed sample; false at end of trace
+bool traceReplayNext(Sample& s);
+
+struct TraceStatus {
+  bool     recording;
+  uint32_t recRows;
+  bool     replaying;
+  bool     done;        // a replay finished since boot (results below)
+  uint32_t rows;        // samples replayed
+  uint32_t elapsedMs;   // wall time of the replay
+  uint32_t traceMs;     // trace time covered
+  uint32_t bins;        // 1 Hz bins closed
+  uint32_t logRows;     // log rows written
+  uint32_t nudges;
+  uint32_t gateOn, gateOff;
+  uint32_t onsets, missed;  // ΔP onsets shown / lost before the gate opened
+  uint32_t latMeanMs, latMaxMs;   // onset → gate open (airspeed filter delay)
+  float    dpZeroEnd;   // dp_zero at the end of the replay
+};
+void traceStatus(TraceStatus& st);
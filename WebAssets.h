@@ -0,0 +1,362 @@
+#pragma once
+// Generated by tools/embed_assets.py from web/ — do not edit.
+#include <Arduino.h>
+
+struct WebAsset {
+  const char*    path;
+  const char*    type;
+  const uint8_t* gz;       // gzip body (PROGMEM)
+  size_t         len;
+  const char*    etag;     // strong, quoted
+};
+
+// app.js: 14512 B → 5133 B gzip
+static const uint8_t APP_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x5b,0x4b,0x77,0xdb,0x48,0x76,0xde,0xfb,0x57,
+  0x94,0xdd,0x9e,0x06,0x60,0x42,0x10,0x49,0x4b,0x1e,0x37,0xd9,0xb4,0x8f,0xed,0xb1,0xc7,0xce,0xd8,0x63,
+  0x1d,0x49,0xfd,0x98,0x91,0x75,0xac,0x22,0x50,0x20,0x21,0xe1,0x35,0x00,0x48,0x51,0xa6,0x99,0xd3,0xd9,
+  0x64,0x95,0x55,0xa6,0x97,0xc9,0x36,0xeb,0x9c,0x93,0x6d,0x56,0x93,0x7d,0xf2,0x1f,0xfc,0x4b,0xf2,0xdd,
+  0xaa,0xc2,0x8b,0x92,0x68,0xd9,0xe7,0x8c,0xbb,0x4d,0x00,0x85,0xba,0x55,0xb7,0xee,0xab,0xbe,0x7b,0x0b,
+  0x76,0x93,0x38,0x2f,0x98,0x1f,0x15,0x6c,0xc4,0xe6,0xa3,0x47,0xcc,0x7c,0xc3,0x8b,0xa9,0x93,0x25,0xb3,
+  0xd8,0x33,0xe7,0xf7,0x7a,0xdd,0xae,0xb5,0x4d,0x3f,0x4e,0x91,0xbc,0x08,0x16,0xc2,0x33,0xfb,0xd6,0xf0,
+  0x56,0x28,0x0a,0x16,0x26,0x93,0x49,0x10,0x4f,0x46,0x3e,0x0f,0x73,0x61,0x33,0x77,0x96,0xbd,0x08,0x42,
+  0x31,0xba,0x73,0x67,0x78,0xcb,0x95,0x43,0x86,0xc1,0x5c,0x60,0xcc,0x65,0x31,0x38,0x3a,0xb6,0x99,0x97,
+  0xca,0xcb,0x9c,0xcb,0x4b,0xe1,0xe2,0xb2,0x1a,0xde,0xba,0xb5,0xbd,0xcd,0x9e,0x4d,0x79,0x56,0xe4,0x03,
+  0x16,0x05,0x71,0x10,0xf1,0x90,0xb9,0x3c,0x9e,0xf3,0x1c,0xe4,0xb1,0x60,0x69,0x98,0x14,0x85,0xc8,0x98,
+  0x19,0x27,0x4c,0x2c,0x70,0x17,0xa3,0x43,0x18,0x8c,0x33,0x9e,0x05,0x22,0x67,0x9f,0x7e,0xf9,0x95,0x15,
+  0x53,0xc1,0x9e,0xec,0xb1,0x29,0xcf,0x69,0x30,0xf4,0x0b,0x62,0xea,0x27,0x0a,0xcb,0x61,0xaf,0x85,0x5f,
+  0x6c,0x67,0xc1,0x64,0x5a,0xb0,0x0b,0xc6,0x17,0x22,0xc7,0xcc,0x41,0x24,0xd8,0x02,0x0f,0x01,0x1e,0x52,
+  0x91,0x6d,0xa5,0x58,0x55,0x48,0x93,0x6f,0x47,0x7c,0xc1,0x3c,0xe1,0x82,0x89,0x22,0x48,0x62,0xe7,0x96,
+  0x1b,0xf2,0x3c,0x67,0xaf,0xc1,0x87,0x64,0x91,0x2d,0x6f,0x31,0x26,0x97,0x96,0xcd,0xdc,0x22,0xc9,0x4c,
+  0x77,0x8e,0xe1,0x6c,0x96,0x0b,0xe2,0xc5,0xa2,0xb7,0x0c,0xdc,0x04,0xb9,0xe3,0xce,0xb1,0x6e,0x77,0x3e,
+  0x54,0x4f,0x24,0xd8,0x42,0xdf,0xe7,0xb8,0x57,0xfd,0x75,0x43,0x2a,0x62,0x0f,0x52,0x44,0xb3,0x94,0xe3,
+  0x50,0x0e,0x12,0xf8,0xcc,0x3c,0x0f,0x62,0x2f,0x39,0x77,0xf6,0x45,0x1e,0x7c,0x10,0x6f,0xc7,0x20,0x9a,
+  0x8b,0xcc,0x62,0xb1,0x38,0x67,0xed,0x36,0xd3,0xb4,0x46,0x8f,0xe4,0x58,0xb3,0xd4,0xe3,0x85,0x30,0x2d,
+  0xcb,0x49,0xd4,0x3b,0x70,0xe8,0xa4,0x3c,0x13,0x71,0xf1,0x3c,0x14,0x11,0x2e,0x16,0x8d,0xbf,0xc2,0xdf,
+  0xb2,0xeb,0xb2,0x9a,0xaf,0xc9,0x8d,0xc5,0x32,0x51,0xcc,0xb2,0x78,0x58,0x2f,0xa9,0xe6,0x13,0xab,0xd7,
+  0x6c,0x66,0xe2,0x2f,0x33,0x91,0x17,0x4f,0x62,0x2d,0xb1,0x17,0x19,0x8f,0x84,0x64,0x67,0x79,0xf5,0xe2,
+  0x54,0xab,0x97,0xf1,0x73,0xd3,0x1a,0xb2,0x55,0xc5,0x4d,0xc6,0xe3,0x89,0x30,0x49,0x25,0x9a,0x21,0x65,
+  0x5f,0xa0,0x7b,0x15,0xfb,0xb0,0x8a,0xe2,0xc2,0x66,0xd3,0x00,0x8f,0x5b,0xe5,0xb3,0x62,0xc0,0x4f,0x60,
+  0x19,0xca,0xd8,0x72,0x96,0xf8,0x5a,0xc4,0x96,0x5c,0x8f,0x99,0x3b,0x34,0xe0,0xc7,0x8f,0x46,0x68,0x58,
+  0x6c,0x34,0x1a,0x49,0x95,0x5b,0x92,0xae,0x45,0x39,0x27,0x4a,0x70,0xc5,0x0b,0xae,0x28,0xe7,0xec,0xf6,
+  0x88,0xc5,0xb3,0x30,0x64,0xdf,0x7e,0xcb,0x82,0xfc,0x05,0x4d,0x28,0xcc,0xb9,0x65,0xb1,0xa5,0x7e,0xff,
+  0x3d,0x98,0xb3,0x14,0x83,0x50,0xb2,0x6a,0x7b,0x04,0x0e,0x2d,0xc5,0x25,0xda,0x56,0x95,0x5c,0xd1,0x4b,
+  0xbd,0x52,0x22,0x95,0x03,0x2b,0xee,0xd5,0xf4,0x29,0xf7,0x40,0x62,0x82,0x70,0x4b,0x8e,0x7a,0x8f,0x75,
+  0x9d,0xee,0x2e,0xfb,0xf8,0x91,0x49,0x3f,0xe4,0xe3,0xdc,0x24,0xea,0xba,0xb9,0x57,0x0a,0x5f,0x0e,0x77,
+  0x84,0xf1,0xb7,0x68,0x10,0x29,0xa1,0x0e,0xdd,0x1d,0x97,0x62,0x55,0x82,0x5e,0x36,0x26,0x93,0x86,0xa9,
+  0x4d,0x94,0x5c,0x32,0xc3,0xa3,0x36,0x34,0x4f,0xcc,0x03,0x57,0xec,0x91,0x33,0xec,0x93,0x36,0xe5,0x54,
+  0x36,0x1b,0x27,0x0b,0x69,0xcb,0x6d,0x3b,0x6a,0x2e,0xe0,0x27,0xbc,0x47,0x2f,0xc7,0x0d,0x03,0xbc,0xf9,
+  0x29,0xf0,0x8a,0xa9,0xcd,0x5e,0xb6,0x1a,0x5f,0x0a,0x72,0xc1,0xda,0xb6,0x31,0xdc,0x39,0xf5,0x83,0xa0,
+  0x47,0xec,0xa7,0x7b,0xc4,0x07,0x66,0x43,0xeb,0x54,0x76,0x94,0xcd,0x2f,0xa9,0xd9,0x62,0x4b,0xad,0xb0,
+  0x8a,0x44,0x13,0x0c,0x1b,0xdd,0x75,0x67,0xd9,0x94,0x17,0x17,0xa1,0xa8,0xbb,0x76,0x8c,0x74,0x61,0x34,
+  0x5e,0xd4,0x14,0xea,0x8d,0x1c,0x7d,0xd5,0x58,0xcd,0x44,0xad,0x76,0x22,0x8a,0x67,0x09,0xe2,0xc8,0xa2,
+  0x30,0x8d,0xbe,0x67,0x58,0xaa,0xe3,0xc4,0xc9,0x45,0x71,0x08,0x6b,0xcd,0x61,0x3f,0x91,0x89,0x39,0x6d,
+  0xd6,0x95,0xff,0x57,0xb7,0x55,0x4f,0x37,0x14,0x3c,0xdb,0x17,0x6e,0x61,0xaa,0x1e,0x3f,0x41,0x28,0xd5,
+  0x4b,0x1f,0x63,0x63,0x22,0xa3,0xd7,0x4f,0x17,0x2c,0xbf,0xc8,0x0b,0x11,0x6d,0xcd,0x02,0x3b,0xc7,0xc8,
+  0x5b,0x14,0x1e,0x7c,0xf0,0x3c,0x71,0x28,0x02,0xfe,0xa4,0x57,0xd2,0x6b,0x8a,0xfc,0x35,0x1a,0x76,0x1e,
+  0xda,0x6c,0xbf,0xd4,0x26,0xfe,0x4b,0xe0,0x7a,0xf9,0xe8,0x91,0xb2,0x7a,0x98,0xbb,0x91,0xc1,0xec,0x1f,
+  0xa3,0x1b,0x1b,0xb0,0x5e,0xdf,0x66,0x87,0xe8,0xdb,0xc7,0xf5,0x29,0x5d,0xbb,0x2d,0x0b,0x3c,0x27,0x49,
+  0xc1,0x8a,0x5e,0xe3,0xef,0x3e,0x82,0x22,0xcd,0xf7,0x12,0xf7,0x87,0xf8,0xfb,0x14,0x21,0xae,0x9c,0x05,
+  0xb1,0x2e,0xa6,0x7b,0x27,0x14,0xf1,0xa4,0x98,0x22,0x7a,0xd3,0x20,0x08,0xba,0xa1,0x98,0xc0,0xd3,0x6b,
+  0xcf,0x25,0x93,0x79,0xbd,0xd9,0x45,0x4b,0xbd,0x42,0x16,0x41,0x18,0x1e,0x90,0x72,0x28,0x34,0x3a,0x6e,
+  0x12,0x26,0xd9,0x50,0x37,0x4b,0xf1,0x85,0x0b,0x9b,0x3d,0xb0,0xe5,0x1a,0xee,0x6b,0x01,0xae,0x93,0x19,
+  0xdf,0x88,0x5d,0xf1,0x5b,0x31,0x36,0x4a,0xc2,0x43,0x52,0x5c,0xee,0x84,0x7c,0x2c,0x42,0x9b,0xf8,0xe9,
+  0xb0,0x9e,0x1c,0x03,0x61,0x87,0x9e,0x46,0xe8,0x17,0x09,0x9e,0xcf,0x32,0xd1,0xec,0x6a,0x69,0xc3,0xe9,
+  0xb0,0xfb,0x3b,0x4d,0xd3,0x20,0x9b,0x8d,0xe1,0xf5,0x7d,0x32,0x53,0x88,0xeb,0x7b,0xd6,0xeb,0xca,0xdb,
+  0xa9,0xbc,0xad,0xc3,0x65,0x43,0xaa,0x45,0x17,0x8c,0x75,0x8a,0xa3,0x2e,0xed,0x76,0x3d,0x75,0x1f,0x6f,
+  0xf5,0xe8,0x89,0x36,0x01,0x13,0x6d,0x5b,0xe8,0x64,0x35,0x5c,0x5a,0x11,0xfe,0x8c,0xb7,0x11,0x34,0x09,
+  0x75,0x74,0x98,0x19,0xe5,0xba,0xdb,0x36,0xd1,0xdd,0xc3,0xec,0xcd,0xbe,0x9c,0x24,0xbd,0x0c,0x07,0x4a,
+  0xac,0x2a,0x8c,0x52,0xbc,0xb3,0x59,0xd6,0x6e,0x83,0x31,0xac,0x6a,0x7d,0x4d,0xb2,0xc0,0xc3,0xe0,0x64,
+  0x29,0x4c,0x2e,0x3c,0x2f,0xcd,0xbb,0xc8,0x92,0x33,0x51,0x8b,0xb5,0xe7,0xf7,0xbf,0xbb,0xff,0xdb,0x4a,
+  0xac,0xf5,0x8b,0xef,0x76,0xf8,0xfd,0xf1,0x43,0xa3,0xa1,0x63,0x52,0xfc,0x19,0xde,0x75,0x87,0xb8,0x7c,
+  0x0f,0xfb,0xc4,0xb5,0xd3,0x69,0x38,0xb0,0x64,0xf8,0x02,0x3d,0x0e,0x29,0x4c,0x4d,0xb1,0x96,0x33,0x2c,
+  0x6a,0xa7,0xd6,0xe8,0x58,0x00,0x4f,0xec,0x21,0xe8,0xd1,0xe6,0x00,0xfd,0x24,0x73,0x71,0x98,0x98,0xaf,
+  0x6d,0x76,0x61,0x95,0xde,0x40,0xcf,0x44,0x7d,0x5e,0x36,0x2a,0x86,0xcd,0xca,0x2e,0x48,0x53,0x7c,0xe1,
+  0x84,0x14,0xab,0x27,0x0e,0xf9,0xef,0x93,0x30,0x98,0x90,0xd5,0x1a,0x12,0x06,0xb4,0x2d,0x44,0x76,0x3d,
+  0xea,0x1d,0x43,0xc4,0xe5,0xed,0x96,0xbc,0x76,0x8f,0xad,0x7b,0x67,0xdb,0x3b,0x4d,0xd0,0x63,0x4b,0xf7,
+  0xd8,0xc1,0xc4,0x60,0x60,0xc7,0x2a,0x43,0x7c,0x35,0x65,0x46,0xbb,0xc5,0x3e,0x62,0x3d,0x8c,0xec,0xf2,
+  0xe4,0x21,0x80,0xc8,0xe5,0xb9,0xb3,0x7a,0xee,0x4c,0xcf,0x9d,0x5d,0x37,0x37,0xad,0x9a,0x66,0x5e,0x67,
+  0x60,0xa5,0x55,0xd7,0x9a,0xce,0x15,0x84,0x81,0xbe,0x5c,0x3d,0x11,0x99,0x26,0x2c,0xb7,0xa3,0x8c,0x6d,
+  0x4d,0x41,0x15,0xef,0x04,0x42,0x7e,0x47,0xf8,0x21,0xca,0x89,0xcd,0xd7,0x89,0xcb,0x43,0x71,0x08,0x60,
+  0x75,0x50,0x64,0xd8,0xef,0x4d,0x30,0x2c,0x37,0x2f,0x80,0x2a,0x85,0x26,0x81,0xac,0xcc,0x9f,0xa9,0xb7,
+  0x5a,0xc9,0xfd,0x6e,0xbd,0xa4,0x2d,0xf5,0x44,0xf1,0x66,0xc7,0x1a,0x5e,0xbf,0x24,0x25,0xc1,0xca,0x84,
+  0x15,0x88,0x1a,0x30,0x0e,0xa6,0x13,0x70,0x9e,0x00,0x2c,0x96,0x18,0x2e,0xe5,0x41,0x46,0xd0,0x8e,0x29,
+  0x68,0x87,0x90,0x32,0x8b,0xe2,0x1b,0x45,0x23,0xf5,0x8a,0x76,0x45,0xbe,0x38,0x6a,0x00,0x88,0x63,0xb5,
+  0xcb,0xdf,0xc6,0x86,0x84,0x2e,0x45,0x10,0x97,0x10,0xa8,0x24,0xf9,0x93,0x06,0xcf,0x64,0xdb,0xa6,0x56,
+  0xeb,0x9c,0x9c,0xb6,0x7c,0x90,0x7a,0x25,0xff,0x9d,0xd6,0xf2,0x6c,0x7b,0x5b,0x23,0xf6,0xb5,0x02,0xbf,
+  0xb3,0x3b,0x5c,0x73,0x0e,0x3d,0x00,0xa9,0x14,0x24,0x04,0x8b,0xb0,0x51,0x47,0x24,0x25,0xec,0x33,0xd1,
+  0x42,0x5d,0x81,0xbd,0xda,0xa0,0xb2,0x64,0xd5,0x0f,0x67,0x39,0x0d,0xac,0x70,0x9a,0xdc,0x8e,0x31,0xc8,
+  0xf7,0xac,0xdb,0x46,0x7d,0xa5,0x69,0xdf,0xc6,0x40,0xca,0xa0,0xb5,0x43,0xa2,0xb7,0xcd,0xfe,0x64,0x46,
+  0xb1,0x05,0x1b,0x54,0xb3,0x48,0x48,0xc8,0x56,0x0c,0x81,0x44,0xd4,0x9e,0xda,0xec,0xd8,0x1a,0x12,0x2c,
+  0xd2,0x0e,0x8f,0x17,0x97,0x3b,0x2f,0x68,0xd4,0xd5,0xb0,0x09,0xd3,0x68,0x9d,0x81,0x32,0xdd,0x00,0x7c,
+  0xc6,0xb8,0x34,0x2d,0xb7,0x5c,0xd7,0x5c,0xca,0x90,0x60,0xdc,0x51,0x70,0xdc,0x9e,0x10,0xaf,0x34,0xa2,
+  0x43,0xb0,0xbd,0xbd,0x06,0xe9,0xa4,0x3c,0x28,0xe4,0x94,0xb2,0x1c,0xb6,0x64,0x57,0x2b,0xbc,0xf2,0xf8,
+  0x0a,0x4d,0xa1,0x53,0x23,0x59,0xfa,0xd9,0x44,0x88,0x0f,0x8e,0xd7,0x57,0xeb,0xca,0xc5,0x62,0xf0,0x2b,
+  0x26,0x73,0x87,0x4a,0x6f,0x52,0x69,0xf3,0xe6,0x0c,0x52,0x94,0x35,0xde,0x24,0x59,0xc9,0x9e,0x0d,0xbc,
+  0x09,0x59,0x5d,0x22,0x2c,0xaf,0xd5,0x3c,0xeb,0x21,0x72,0x25,0xb1,0xe1,0x4a,0xa7,0x68,0xee,0x94,0x76,
+  0x26,0x72,0xe7,0x2a,0xcb,0x31,0xbd,0xc4,0x9d,0x11,0xc6,0x23,0x0c,0xa4,0xe1,0xde,0xd3,0x8b,0x57,0x9e,
+  0x69,0xb8,0x3d,0xda,0x58,0x28,0xab,0x23,0x24,0x70,0x84,0x81,0x96,0x72,0xf3,0x18,0x18,0xff,0xfb,0xeb,
+  0x1e,0x33,0xf7,0xb8,0x65,0x00,0x08,0x41,0xfe,0x03,0xd9,0xc7,0x4b,0x6d,0x26,0x2d,0x7a,0x60,0x7c,0xd3,
+  0xef,0xbb,0xbb,0xbb,0xc2,0x58,0xd9,0x0d,0xa2,0x1f,0x61,0x08,0xdb,0x79,0x9b,0x66,0xce,0x6b,0x1a,0xec,
+  0x2f,0x7d,0xff,0x01,0x5e,0x93,0x17,0x0e,0xb0,0x83,0xad,0x8e,0xad,0x61,0xc5,0x77,0xff,0x0b,0xf8,0xee,
+  0x5f,0xc7,0xf7,0xa1,0x88,0x52,0x66,0xfe,0xed,0x3f,0x9f,0xb5,0xb9,0x28,0xdc,0x9a,0x0b,0x7f,0xf7,0x3b,
+  0xd1,0x1d,0xab,0xb9,0x6f,0xf9,0xb3,0xd8,0xa5,0x44,0x07,0xd1,0xa7,0x38,0x28,0x28,0x00,0x22,0x61,0x61,
+  0xd7,0x4e,0x9c,0x53,0x17,0xc3,0x92,0x71,0x4c,0xa2,0x49,0x09,0xfa,0x72,0xd2,0xd6,0x2d,0x9e,0x5f,0xc4,
+  0x2e,0xab,0x07,0xc4,0x13,0x05,0x50,0x05,0xd7,0x8b,0xec,0xa2,0x89,0xda,0x45,0x9a,0xb8,0xd3,0xf7,0x32,
+  0x36,0x53,0xd4,0x75,0xe2,0x44,0xe6,0x4f,0xeb,0x7f,0x10,0x15,0xc7,0x59,0x72,0x8e,0xc8,0xc8,0xce,0x39,
+  0x6c,0x9d,0x32,0xdd,0x26,0x20,0xf9,0xf0,0x1e,0x01,0x12,0x8f,0x4a,0x70,0x32,0x7e,0x5b,0xc4,0x33,0xcd,
+  0xfb,0x01,0xf1,0xf3,0xad,0xef,0x63,0x5d,0x34,0x32,0x46,0x42,0xd7,0x59,0x81,0x0c,0xfb,0x5c,0x50,0x70,
+  0xf5,0xd9,0x0f,0x87,0xcf,0x98,0x29,0x9c,0x89,0xc3,0x0e,0xff,0xe7,0xbf,0xb3,0xb3,0xe0,0x42,0x48,0x5f,
+  0x79,0xd8,0x55,0x19,0x15,0x3f,0xe7,0x01,0x42,0x8b,0x28,0xdc,0xa9,0x69,0x6c,0xf3,0x34,0xd8,0xa6,0xd9,
+  0x0d,0x7b,0x19,0x89,0x62,0x9a,0x78,0x03,0x63,0xef,0xed,0xc1,0x21,0x84,0x3c,0x15,0xdc,0x13,0x59,0x3e,
+  0x58,0x1a,0x5a,0x20,0x5b,0x87,0x17,0xa9,0x30,0x06,0x06,0x4f,0xd3,0x30,0x70,0x65,0x1a,0xb9,0x7d,0x9a,
+  0x27,0xb1,0xb2,0x15,0xfa,0x33,0x4e,0xbc,0x8b,0x01,0xfb,0x87,0x83,0xb7,0x7f,0x24,0x53,0xc6,0xf6,0x12,
+  0xf8,0x17,0xe6,0xb2,0x94,0x89,0xad,0xd7,0xb5,0xb2,0x74,0x3a,0x89,0x31,0xc0,0x83,0x80,0x5e,0x68,0xd9,
+  0x09,0x25,0x03,0x3c,0x8b,0x4d,0x43,0xe6,0xfd,0x4a,0xe8,0x3c,0x08,0x85,0x07,0x66,0x84,0xdc,0x44,0xa1,
+  0x8c,0xc6,0xb6,0x00,0x60,0x84,0xd5,0x1e,0x19,0x49,0x9e,0xa5,0x86,0x4d,0x97,0xc2,0x38,0xb6,0xea,0xd4,
+  0x1f,0xaa,0x27,0xc7,0xbd,0x4e,0xe7,0x81,0x27,0xb9,0x38,0xea,0xef,0x3e,0xb0,0x77,0x01,0x59,0x7b,0xdd,
+  0xfe,0x8e,0xdd,0xef,0x02,0xac,0xef,0x74,0xbf,0x7b,0x70,0x0c,0xe0,0x9f,0x3d,0xe7,0xe0,0x6f,0x4e,0xb1,
+  0x57,0x0d,0x98,0x8c,0xaa,0xc1,0xdc,0x4c,0x40,0x2b,0x7a,0x3c,0xd3,0x48,0x52,0x12,0x07,0x92,0x0f,0x96,
+  0xc0,0x33,0xc2,0x99,0x18,0xcd,0xe9,0xb6,0x61,0x4e,0xd4,0x00,0x86,0x1c,0x48,0x0f,0x00,0xfc,0xd9,0x34,
+  0x08,0x3d,0x33,0xd1,0xa9,0xf5,0x65,0x23,0x0b,0x13,0xee,0x1d,0x88,0x02,0xd1,0x6c,0x92,0x2b,0x43,0x6b,
+  0xec,0x77,0x97,0x14,0x98,0xeb,0x9e,0x86,0x8c,0x56,0x6a,0xcb,0x2c,0xfb,0x65,0x0e,0xe9,0x48,0xc5,0x94,
+  0x6b,0xcd,0x3f,0x88,0xe7,0x02,0xd2,0xb3,0x1c,0x77,0x2a,0xdc,0x33,0x41,0x69,0xee,0xed,0xdb,0xb9,0xa3,
+  0x9a,0x37,0x52,0x86,0xc9,0x24,0xc2,0xbc,0x6a,0xd1,0xd2,0x62,0x01,0xd0,0xa9,0xed,0x73,0x54,0x7e,0x54,
+  0xd4,0x64,0x9a,0x0a,0x6d,0x1b,0xc9,0x64,0xa8,0xcc,0xdb,0x64,0xb2,0x2d,0xca,0xa9,0xf0,0xd5,0xdd,0x48,
+  0x7c,0x26,0x44,0x9a,0xba,0xf5,0xa4,0x44,0xac,0xdb,0x36,0xd2,0x71,0x8f,0x43,0xb9,0x73,0x71,0x49,0x3a,
+  0xe5,0x8b,0xcd,0x2c,0x07,0x61,0xd1,0x10,0x90,0xe4,0x58,0x36,0x6d,0xa4,0x82,0xf7,0x08,0x1e,0xd5,0x74,
+  0x44,0x56,0xb6,0x6d,0x24,0x2c,0x04,0x34,0x76,0xd1,0x96,0x90,0x6a,0xdb,0x48,0x26,0x5d,0xa8,0x56,0xa2,
+  0x24,0x43,0xdb,0xfb,0xf4,0x73,0x54,0xc5,0x55,0x54,0x9b,0xe5,0x29,0xe2,0xf9,0xf4,0xc3,0x9a,0xc5,0xc8,
+  0x36,0xa2,0x42,0x38,0x83,0xcb,0x64,0x9c,0xd1,0x3e,0x95,0x0b,0x44,0x05,0x44,0x20,0x89,0x18,0x95,0x2d,
+  0xca,0x22,0x87,0x80,0x5b,0x56,0x1e,0xa1,0xaa,0x1e,0xd7,0x6b,0x6f,0xb6,0x00,0x25,0x39,0x06,0xd5,0x38,
+  0x82,0x38,0x16,0xd9,0xcb,0xc3,0x37,0x94,0x95,0x1b,0x12,0x73,0x53,0xed,0x69,0xb6,0xf8,0xf8,0xf1,0xe8,
+  0xd8,0xaa,0x3c,0xde,0xe4,0x76,0x40,0x88,0xab,0x11,0x91,0x5b,0x81,0x64,0xcd,0xf7,0xe5,0x0e,0x55,0xd6,
+  0x1d,0xc2,0xd6,0x1c,0x27,0xdf,0x07,0x71,0x3a,0xa3,0x50,0x35,0xba,0xe3,0xa5,0x77,0x97,0x41,0xa7,0xb7,
+  0x7a,0x0f,0x7e,0xee,0xb0,0x02,0xb1,0x74,0x74,0x47,0x1a,0x14,0x18,0xbb,0xf3,0x88,0xbd,0x52,0xeb,0xc3,
+  0xba,0x55,0xb7,0xbb,0x4b,0xee,0x24,0xb1,0xac,0xac,0x3e,0x06,0xaf,0x6c,0xc0,0x0c,0x66,0x26,0xbe,0x4f,
+  0x2d,0x96,0xb1,0x3a,0x51,0xd3,0xd1,0xa2,0x9a,0x11,0x25,0xd4,0x6c,0x5c,0x27,0x8f,0x93,0x26,0x17,0x27,
+  0x6d,0x8b,0xe6,0x0d,0x7f,0xbf,0x3a,0x2a,0x65,0xc2,0xcf,0x44,0x3e,0xa5,0xe2,0xf1,0x0d,0xa2,0x92,0x4f,
+  0xdd,0xea,0x90,0x74,0x7a,0x65,0x48,0xba,0x49,0xa4,0x36,0xaa,0x91,0x28,0x80,0x56,0xf2,0x1d,0x69,0x0d,
+  0x9e,0x3a,0xf2,0x7d,0x5b,0x87,0x7e,0x5b,0x7f,0x31,0x8f,0x84,0x4c,0xe5,0x21,0x76,0x6c,0x1a,0xbe,0xac,
+  0x32,0x1a,0x6a,0x93,0x92,0xc5,0x17,0x1f,0x02,0xf6,0x1d,0xea,0xd6,0x4c,0xda,0xa9,0x78,0x7b,0x99,0x2c,
+  0x19,0x9f,0x0a,0x04,0x12,0xca,0x22,0x7d,0x87,0xba,0xdc,0x1e,0x11,0x62,0xa5,0x61,0x4e,0x98,0x79,0x77,
+  0xa9,0x1a,0x57,0xec,0xa9,0x75,0x42,0x6a,0xd3,0xb9,0x1d,0x15,0x5f,0x92,0x09,0xb6,0xe9,0x00,0xc9,0x02,
+  0x8f,0x61,0xd0,0x9e,0x58,0x0c,0x54,0x91,0x3b,0x4f,0xd1,0xd0,0x61,0x04,0x09,0x9a,0xb3,0x53,0xeb,0xe6,
+  0xd9,0x8b,0xae,0x9e,0x5b,0xef,0xc0,0xc4,0xc1,0xdd,0x65,0x05,0x1a,0xa8,0x43,0x9d,0xf6,0x95,0x29,0xdf,
+  0x8a,0x7d,0xfa,0xe5,0xaf,0x6b,0xdd,0x7a,0x57,0x67,0x87,0x2b,0x9b,0xd1,0x7a,0x88,0xb1,0x95,0x64,0xaf,
+  0xb9,0xa2,0x2f,0xdf,0x14,0xa5,0x7c,0xd7,0xf6,0x45,0x6a,0xeb,0x90,0xc0,0x3a,0xb4,0xde,0x2b,0x37,0xc9,
+  0xda,0x20,0x6b,0x14,0x36,0x4d,0xce,0x09,0xd7,0xcd,0x72,0x93,0xd0,0x2b,0xa1,0x51,0xc2,0x82,0x5e,0xba,
+  0x90,0x76,0x79,0xad,0x29,0x8d,0x8b,0xf8,0x75,0x32,0xb9,0x84,0xf4,0xf4,0x09,0x09,0x3c,0xed,0xa0,0x48,
+  0xd2,0xf2,0x51,0x7a,0x1d,0x66,0xc9,0xaa,0x23,0x14,0x63,0xf8,0x99,0xc1,0x7f,0x87,0x48,0xe0,0x78,0x41,
+  0xce,0xc7,0xa1,0x72,0x2b,0x7d,0xd8,0x52,0xdb,0x3a,0xc2,0x0d,0x29,0x15,0x9c,0x2a,0x8b,0x8d,0x78,0x6a,
+  0x9a,0x73,0x19,0x71,0x4e,0xec,0xda,0xff,0x47,0x77,0x97,0xf3,0x91,0xd4,0x2d,0xf9,0xff,0xa7,0x5f,0x7e,
+  0x25,0x66,0xb0,0x41,0x22,0x15,0x5a,0xc1,0x71,0x4f,0x13,0x24,0xec,0x86,0x8a,0x3a,0x15,0xc4,0x3d,0x01,
+  0x35,0xe8,0xa8,0x97,0x97,0x42,0xcd,0x7b,0x1c,0x51,0x64,0xb6,0x80,0x12,0x7f,0xd4,0xcd,0x73,0x8e,0x66,
+  0x60,0x79,0x9b,0x1d,0xea,0x96,0xc2,0x45,0x0b,0x70,0xf5,0xdd,0x65,0x2d,0x03,0x79,0x58,0xa3,0x1f,0xd9,
+  0xa7,0x7f,0xfe,0x57,0x66,0x74,0xf4,0x32,0x06,0x06,0x42,0xcf,0x15,0xaa,0x78,0x1e,0xcf,0xcd,0x6c,0x9a,
+  0x20,0x03,0x80,0x32,0x38,0xb0,0x3b,0x9f,0xda,0x74,0xce,0xf3,0xb2,0x11,0x25,0x10,0xe4,0x37,0x39,0xb9,
+  0x90,0x61,0xba,0xea,0x3d,0x4d,0x39,0x89,0x89,0xa7,0xed,0x23,0xad,0x5e,0xa3,0x4b,0x36,0xa5,0xdd,0x83,
+  0x66,0x21,0xbb,0xb7,0xd9,0xfe,0x4b,0xac,0x89,0x4f,0xab,0xbe,0x5d,0x6b,0xf5,0x9b,0xda,0x5e,0x31,0xfe,
+  0x9a,0xd2,0x4f,0xfe,0xef,0x9f,0x40,0x00,0xb6,0x2b,0x8a,0xfb,0x90,0xc5,0xd9,0x64,0x3b,0xfa,0xdb,0x7f,
+  0xd9,0x8c,0x24,0x09,0x26,0x56,0x6c,0xba,0xc7,0x95,0xb8,0x78,0xd1,0x60,0x43,0x0b,0x2d,0x9b,0x52,0x28,
+  0x6e,0x8a,0x83,0x7b,0xde,0x1e,0x94,0x03,0xc9,0x92,0x39,0x36,0x4d,0xf3,0x3d,0x41,0x60,0xf7,0x7d,0xde,
+  0x90,0x49,0x1e,0x6d,0x12,0x49,0x1e,0x25,0x49,0x31,0xad,0x81,0x07,0x2d,0x43,0xa5,0x3d,0x4e,0x4a,0x49,
+  0x63,0x41,0x35,0x52,0x95,0xc0,0xa9,0x86,0x3c,0x7a,0x2c,0xe7,0xc1,0xa2,0x61,0x00,0xfa,0xe5,0x9c,0xab,
+  0x97,0xd0,0xbd,0x6e,0x29,0xdc,0xba,0x3b,0x31,0x84,0xee,0x30,0x03,0x1a,0x5d,0x1e,0x83,0xa8,0x19,0x54,
+  0xe5,0xf8,0xd1,0xeb,0x57,0x3f,0x3e,0x7f,0xff,0xe6,0xc9,0xcf,0x40,0xe9,0xfa,0x45,0x3e,0x0d,0x7c,0x99,
+  0x7b,0x94,0x53,0xb7,0x1b,0x30,0x5d,0xbb,0x01,0xb3,0x55,0x0d,0x12,0xc3,0x23,0x12,0xee,0x51,0x61,0x43,
+  0x21,0x1a,0x66,0x1e,0x1c,0x3c,0xb7,0x06,0x4c,0xa2,0x14,0x96,0xf3,0x28,0x0d,0x85,0xcd,0xc6,0x94,0x1b,
+  0x60,0xc5,0x94,0xda,0x87,0x39,0x1e,0xdd,0x33,0x56,0x24,0x2c,0x4d,0xc2,0x90,0x8c,0x12,0x72,0x16,0x59,
+  0x96,0x64,0x3a,0xc9,0x2c,0x99,0x84,0x30,0xef,0x4b,0x1c,0x48,0x85,0x08,0x41,0x20,0x98,0x1c,0xc8,0xae,
+  0xc8,0xaa,0x2a,0x4b,0x29,0xfd,0x1e,0x95,0x7e,0x97,0xf1,0x40,0x9e,0x0b,0xd0,0x6f,0xe1,0x0e,0xba,0xab,
+  0xa1,0x0a,0xd7,0xbd,0xee,0x56,0x0a,0x2b,0x9b,0xc5,0x31,0xd1,0x46,0x82,0xc7,0xf2,0x18,0x52,0xf3,0xd8,
+  0x70,0x00,0x8a,0x10,0x07,0x72,0x31,0x6a,0x57,0x94,0xc5,0x18,0x7d,0x58,0xf3,0x7c,0x0e,0x75,0x1e,0x24,
+  0xb3,0xcc,0x15,0x54,0x55,0x90,0x7d,0xf7,0x14,0x3b,0x24,0x10,0x5d,0xc7,0x91,0xc9,0xbe,0x62,0x18,0x41,
+  0xb9,0x41,0x53,0x22,0x7c,0x39,0xba,0xf2,0x0f,0x01,0x94,0x15,0x47,0x22,0xcf,0xf9,0x84,0x36,0x27,0x31,
+  0x6f,0x6f,0x75,0xb4,0xcf,0xca,0x14,0x2c,0xe5,0x59,0x2e,0x4c,0x31,0x57,0xe7,0x65,0x1a,0x9e,0x68,0xa7,
+  0xa6,0xfd,0xfe,0xd4,0x09,0x27,0xc3,0xf2,0x30,0x18,0x2d,0xd8,0x47,0xa9,0xe8,0x42,0xa7,0xc2,0xd5,0xf1,
+  0x00,0xcf,0x0b,0x2d,0xc4,0x4b,0x67,0x04,0x32,0xfb,0x3a,0x75,0xbc,0xba,0xbc,0x43,0xe2,0x74,0xe2,0xb2,
+  0xd2,0x42,0x15,0xc5,0x1e,0x24,0xaa,0x5a,0x3b,0xbd,0xaa,0xd6,0x22,0x1b,0xbc,0x94,0x4a,0xfb,0xa6,0x47,
+  0xb5,0x54,0xdd,0x60,0x6d,0xab,0xae,0x43,0xd5,0xa3,0x70,0x75,0x8f,0xfb,0xba,0x07,0x4c,0xb4,0xec,0xa1,
+  0x47,0xaa,0x5c,0xad,0xda,0xc9,0x4e,0x1d,0x59,0x12,0xf5,0xa8,0x84,0x07,0x95,0x1e,0x51,0x11,0xdf,0x3b,
+  0xea,0xcb,0xdf,0xfb,0xc7,0x76,0x39,0xb7,0x5d,0x4e,0x51,0x57,0xe8,0xd4,0x4a,0xbd,0xf5,0xb3,0x04,0x6a,
+  0xb7,0x9a,0xbb,0x0d,0x35,0xc8,0x61,0xe5,0x4d,0xbf,0xbc,0xa1,0xc1,0x4f,0x9d,0x85,0x1e,0xaf,0x0c,0x89,
+  0xa7,0x8e,0x90,0xa7,0x0a,0x74,0xed,0xe9,0x6b,0x5f,0x5f,0x89,0x82,0x94,0x20,0x8e,0x76,0x8e,0x35,0x99,
+  0x3b,0xed,0x55,0x27,0xc3,0x43,0xaa,0x9c,0xd4,0x4f,0xb4,0x05,0x56,0xca,0x97,0xa6,0x5f,0xd6,0x05,0x25,
+  0x25,0x9a,0xdd,0x30,0xc9,0x25,0x5d,0x65,0xf7,0x9a,0x97,0xb6,0xc5,0xa9,0x36,0x55,0x4a,0x48,0x66,0x85,
+  0x3e,0x03,0x5e,0x77,0x90,0xb6,0x4d,0xc3,0x3c,0x6d,0xd6,0xdb,0x85,0x67,0x59,0xda,0x35,0x0a,0xb8,0x2a,
+  0x85,0x10,0xc6,0x27,0x3c,0x40,0xba,0x0a,0x26,0x33,0xc5,0xa2,0xf2,0xef,0xa7,0xf0,0x57,0xaa,0x41,0xcb,
+  0x23,0x7f,0x57,0x7e,0x35,0xc0,0xfc,0x2c,0x89,0xe4,0x73,0x12,0x6f,0xa9,0x23,0x4c,0xd6,0x43,0xa2,0x3a,
+  0x0d,0xf2,0x22,0xc1,0x70,0x66,0x4a,0xf6,0x4c,0x89,0x2f,0xdb,0x86,0x5b,0xc0,0xc8,0x62,0xe0,0x1c,0x6b,
+  0x1d,0x83,0x8e,0xf5,0xc8,0x57,0x96,0x5f,0xae,0x06,0xa2,0x7a,0x86,0xc7,0xc0,0xae,0xa3,0xde,0xb7,0x79,
+  0x10,0xbb,0x62,0xb4,0xf5,0xa0,0x4b,0x7f,0x08,0x9c,0x04,0xbe,0x79,0x3b,0x73,0x92,0xb3,0x76,0x51,0x75,
+  0x13,0x68,0xbd,0xc6,0x0f,0x2e,0x9b,0x63,0xcb,0x1e,0xe9,0x03,0x8d,0xae,0x55,0xdb,0xe3,0xae,0xfc,0x7d,
+  0xd8,0xb0,0xd0,0x87,0x37,0x34,0x84,0xeb,0x0a,0x27,0xa5,0x28,0x4b,0x19,0x5d,0x55,0x3f,0x69,0x05,0xad,
+  0xca,0x2c,0x96,0xba,0x80,0xac,0x9e,0x29,0x50,0xd5,0x16,0xa1,0x4a,0xc6,0xf4,0x2c,0x2d,0xe1,0x8a,0x92,
+  0x98,0x7a,0x57,0x45,0xbe,0x6a,0x94,0x5a,0x9e,0x37,0xd2,0x93,0x8a,0xab,0x6d,0x95,0x14,0x53,0xa0,0x4e,
+  0xd6,0xfd,0x9c,0x4e,0xae,0x0a,0x6e,0xea,0xa9,0x1d,0xe1,0xca,0xfb,0x46,0x9c,0x6b,0xf8,0xf6,0xa9,0x0c,
+  0x0d,0xa7,0xb2,0xb6,0x79,0x2a,0x6b,0x8b,0xd4,0xb2,0xb0,0xea,0xb3,0x0c,0x80,0x88,0xfa,0x33,0x0c,0x05,
+  0xcb,0x4f,0x1d,0x20,0x08,0x05,0xcd,0xe3,0x59,0x34,0x16,0x99,0x84,0xe6,0xd5,0x4b,0x9e,0x6e,0x78,0x57,
+  0xb4,0xde,0x95,0x20,0xbe,0x8e,0x1e,0x12,0x52,0xd1,0x18,0xf2,0xb7,0x90,0xbf,0x53,0x62,0xbe,0xab,0x62,
+  0x87,0x44,0x58,0x35,0x77,0x3f,0xe4,0x02,0x32,0xe7,0xaa,0x9e,0x08,0x05,0x47,0x29,0x3b,0x29,0x00,0xd9,
+  0x4d,0x59,0x82,0xa3,0x23,0x23,0xe9,0x83,0xca,0xf9,0x74,0x35,0xf0,0xaa,0x10,0x9a,0xd3,0x14,0xb8,0x5a,
+  0x4a,0x00,0x97,0x45,0x42,0x48,0x86,0x9e,0x80,0x65,0x64,0x09,0x92,0x36,0xe9,0x72,0x8b,0x2e,0x48,0x38,
+  0x18,0x82,0x8f,0x91,0xbf,0x17,0x5f,0x66,0xce,0x15,0x92,0x35,0x00,0xa1,0x75,0x04,0x10,0xde,0xa7,0x5f,
+  0xfe,0xc3,0xd0,0x87,0x68,0x8d,0xc0,0x45,0x56,0x66,0xb3,0x3e,0xc5,0x24,0x1d,0x74,0x0e,0x9e,0xfc,0xf8,
+  0xfc,0xd6,0x26,0x70,0x7e,0xc0,0x65,0x19,0x27,0x89,0xdd,0x30,0x70,0xe9,0x88,0x4d,0xd9,0x71,0x19,0x46,
+  0xd7,0x8c,0x54,0x57,0x1c,0x46,0x37,0x2f,0x9b,0x35,0xad,0x54,0x16,0xc1,0x08,0x9f,0x76,0x6e,0x56,0x3b,
+  0x5b,0xa3,0x55,0x1f,0x79,0xdd,0xb0,0x80,0xd6,0xa4,0xd5,0xf5,0xb0,0x11,0xa3,0x68,0xc3,0xee,0x6d,0x98,
+  0xbe,0x5d,0x4d,0x6b,0x8e,0xa1,0xcb,0x62,0x9b,0x78,0x5f,0xab,0xa6,0xb5,0x4e,0xba,0x75,0x5d,0x6c,0x63,
+  0x59,0xe6,0x52,0x51,0xad,0xb5,0x06,0x59,0x21,0xdb,0x28,0xbb,0x76,0x5d,0xad,0x95,0xb3,0xeb,0x3a,0xd9,
+  0x46,0xf2,0xf5,0x02,0x5b,0x73,0x00,0x55,0x2f,0xdb,0x48,0xde,0x2e,0xb3,0xb5,0xb2,0x61,0xaa,0x9a,0x6d,
+  0x56,0x7b,0xb3,0xd8,0xb6,0x4e,0x5a,0x7c,0x96,0xf4,0x4a,0x91,0xcb,0xfa,0xd9,0x66,0xd2,0x56,0xd9,0xad,
+  0x49,0x4b,0x45,0x7b,0x59,0x86,0x5b,0x6a,0x8b,0xb7,0x95,0xed,0xda,0xda,0x0c,0xed,0xd2,0xa4,0xec,0xd2,
+  0x2e,0xec,0x4a,0xc5,0xb6,0x56,0x95,0x5d,0x49,0xdd,0xd6,0xe2,0xb3,0x95,0x24,0xd4,0x05,0x14,0x8a,0xc3,
+  0xd5,0x5a,0x75,0xea,0x2f,0x33,0x74,0x3d,0x10,0xa1,0xa0,0x8f,0xf4,0x9e,0x60,0x13,0x31,0xbe,0x51,0x05,
+  0x3b,0x26,0xeb,0x66,0x46,0x5d,0xcf,0x11,0x21,0xc1,0x14,0xe2,0xf5,0x88,0x6a,0x40,0xde,0x31,0x21,0xdf,
+  0xb0,0x32,0x1e,0xfd,0x85,0xda,0x0d,0xcb,0xe4,0x76,0x89,0x58,0xff,0x4e,0x47,0x1e,0xd4,0xa8,0xc2,0x6b,
+  0xc9,0x16,0x36,0xb4,0xcc,0xc9,0xe5,0x2e,0x83,0x88,0xbf,0xd3,0xfd,0x0e,0xc1,0x8e,0x87,0x10,0xb6,0x69,
+  0xbc,0x3d,0xd8,0x67,0x69,0x96,0x50,0x0d,0xab,0xca,0x35,0x28,0xff,0xce,0x11,0xac,0x34,0xbc,0x3a,0x9f,
+  0x8a,0x98,0x61,0x31,0x08,0xf7,0x8c,0x3e,0xaa,0xcb,0x91,0x19,0x19,0x6b,0xc9,0x03,0xbb,0xb4,0x69,0xca,
+  0x4c,0x82,0x90,0x22,0xcc,0x9d,0xc6,0xd2,0x60,0xa0,0x25,0xa8,0x28,0xf1,0x84,0x2a,0x7f,0xc0,0x61,0x1e,
+  0xe9,0xa0,0xf1,0x98,0x19,0x3d,0xf6,0xf2,0x03,0xa4,0xe3,0x05,0x3c,0x96,0x65,0x1f,0x2a,0x3e,0x98,0xaa,
+  0x17,0x52,0xed,0x8c,0x9f,0xdb,0x3a,0x5f,0x93,0x65,0x83,0x28,0x5f,0x61,0x73,0x91,0xa9,0x76,0xe3,0x55,
+  0xb5,0x9d,0xab,0x8d,0x46,0xae,0xf6,0x84,0x42,0xb0,0xc7,0x3e,0xfd,0xdb,0x5f,0xdf,0x51,0x1d,0x86,0xd2,
+  0xa9,0x00,0x0a,0x68,0x0e,0x43,0x15,0x34,0x62,0x6b,0x65,0xbd,0x8b,0xeb,0xa2,0x28,0x75,0xd1,0x01,0x19,
+  0xec,0x41,0x03,0x34,0x59,0xe2,0xfb,0xaa,0x1c,0x71,0x25,0x26,0x92,0x28,0xd9,0x24,0xe4,0xa3,0x25,0x7d,
+  0xd0,0x92,0x02,0xe1,0x21,0x6c,0x9d,0x9b,0xf6,0x8b,0x3d,0xa8,0x65,0xc3,0x7e,0x21,0xc1,0x0e,0x66,0xf3,
+  0x83,0x2c,0xc2,0xe8,0xe7,0xf0,0x0e,0x06,0x6d,0xf6,0x77,0x1f,0x60,0xc7,0xa2,0x43,0x24,0x66,0xfe,0x23,
+  0x12,0xcc,0xdc,0x7a,0xfc,0x2e,0x7e,0x17,0xff,0x81,0x5e,0x8f,0x91,0xcf,0x03,0x2e,0x11,0x1c,0x0e,0x08,
+  0x83,0x11,0x48,0xe3,0x41,0xe6,0x18,0xd6,0x17,0xa3,0x25,0x38,0xd6,0xb6,0xb6,0x9b,0xf5,0xc3,0xbb,0xda,
+  0xea,0xd8,0xb5,0x26,0x31,0x9e,0xe5,0x17,0x55,0xd1,0x1a,0xa9,0xde,0x69,0xe9,0x9a,0x88,0x03,0x6a,0x32,
+  0xea,0x0c,0x09,0x44,0x01,0xd2,0x8a,0xe4,0x6c,0xf4,0xa8,0xb1,0xf7,0x26,0x67,0xb6,0x34,0x15,0xfa,0x02,
+  0xa0,0x86,0x63,0xe6,0x95,0x4c,0x62,0x69,0x25,0x4c,0x03,0x78,0x3c,0x9f,0x92,0x9d,0x03,0x64,0x28,0xd6,
+  0x09,0x26,0x36,0xed,0xa3,0xe9,0x0d,0xef,0xa0,0xe4,0x0e,0x2b,0x7b,0x0a,0x59,0x28,0x4b,0x47,0x8f,0x4e,
+  0xd0,0xe5,0xee,0x32,0xa5,0x93,0x86,0x15,0x59,0x45,0xea,0xe4,0x69,0xde,0x2a,0xcc,0x1c,0x50,0x7d,0x8b,
+  0x5e,0xc4,0x09,0x78,0x7f,0xbf,0xc7,0x5b,0xf5,0x9d,0x3d,0xce,0xf6,0xdf,0x1c,0x54,0x25,0x34,0xcc,0x62,
+  0xdd,0xd8,0x82,0xf6,0xb4,0x9f,0x7e,0x89,0x11,0xfd,0x59,0x64,0xc9,0x8d,0x8d,0x88,0x3a,0x33,0x2f,0xf0,
+  0x7d,0x41,0x9f,0x70,0x06,0x80,0x72,0x29,0xb2,0x16,0xfa,0xf8,0x4d,0x9f,0x86,0x48,0x53,0x7a,0xc3,0xcf,
+  0xf0,0x4c,0x8d,0x0d,0x7b,0xe2,0x78,0x4c,0xe8,0x73,0x08,0x60,0xb0,0xeb,0x0c,0x4b,0x47,0xfc,0x22,0xde,
+  0xb4,0x37,0x57,0x3c,0x13,0x05,0x1e,0x9a,0xe5,0xcc,0xf2,0x8b,0xe2,0x1a,0xa8,0x7d,0x40,0x57,0x68,0x51,
+  0x61,0x34,0x65,0xbb,0xec,0xf3,0xc6,0x4b,0x54,0x5f,0x63,0xb5,0x44,0xc7,0x36,0x98,0x6e,0x59,0x18,0xb8,
+  0x89,0x01,0xf7,0x77,0xbb,0xf5,0x07,0x20,0x1b,0xad,0x58,0x72,0x5b,0x9b,0x71,0x09,0xd3,0xab,0xb2,0x6b,
+  0x2d,0x03,0x98,0x9d,0x34,0xd8,0x09,0x69,0x6d,0xf5,0x9b,0x93,0xf2,0x53,0x8e,0xda,0xee,0x75,0x88,0x6f,
+  0xae,0xf5,0x74,0xc3,0x5a,0xdb,0x41,0xbb,0x2d,0xf6,0xba,0x5d,0x07,0x57,0x69,0x3d,0x6e,0x42,0x61,0xb7,
+  0x28,0xa3,0xec,0x81,0x8c,0xc2,0xf9,0x40,0x72,0xa6,0x42,0x72,0xbe,0x7a,0x17,0xff,0x11,0xf3,0x00,0xc7,
+  0xd3,0x30,0xea,0x95,0x7e,0xa8,0x5c,0x65,0x47,0xba,0x8a,0x0e,0xae,0xac,0xf4,0x8d,0x86,0x6a,0x5b,0x0e,
+  0x72,0x05,0x77,0x6b,0xac,0x6b,0x0f,0xfa,0x73,0xfd,0x86,0x7d,0xfa,0xf7,0x7f,0x31,0xf4,0xf8,0xd8,0xd5,
+  0x90,0x42,0x94,0x96,0xb3,0x66,0x74,0xd5,0x97,0x51,0x9f,0x77,0x36,0x55,0xdb,0x2f,0x7d,0xed,0x73,0x08,
+  0xdf,0x8d,0xbc,0x56,0xed,0x1f,0xd9,0x73,0x2a,0x37,0x16,0x99,0x1c,0x1b,0x9f,0x47,0x14,0x20,0x7d,0x8c,
+  0x41,0x46,0x46,0x07,0xbf,0xd7,0x98,0xf3,0xe6,0x42,0x02,0x19,0xc0,0xa9,0x92,0x23,0x65,0xdd,0x5a,0x91,
+  0xaf,0x75,0x26,0x2b,0xdb,0x95,0x7e,0xe4,0xed,0x8a,0xee,0xfc,0xfc,0x7d,0x91,0x14,0x3c,0xc4,0x46,0xfc,
+  0x2e,0x7e,0x71,0xa0,0x5e,0xa3,0x71,0x96,0x0b,0x6f,0xb5,0xdd,0xec,0xb1,0x3a,0xd1,0xf5,0x7a,0x8d,0x10,
+  0xae,0x49,0x90,0x15,0x9b,0x9b,0xb3,0xe4,0xbf,0xeb,0x81,0xca,0xd7,0x1f,0xa9,0xb4,0x32,0xc2,0xe6,0xf1,
+  0x64,0x99,0x19,0xde,0x2c,0xae,0x97,0xf2,0x86,0xef,0x44,0x3c,0xf6,0xbe,0x28,0xbe,0x4b,0xf6,0x2a,0x8b,
+  0x6b,0x7f,0xad,0xa7,0x18,0xa5,0x7f,0x7f,0xa0,0xc0,0xa3,0x33,0x05,0x8f,0x23,0x63,0xdb,0x4b,0xce,0x63,
+  0xaa,0x74,0x3d,0xa6,0xdd,0x04,0xd6,0x23,0x62,0x17,0x88,0xe7,0x87,0xfd,0x57,0xcf,0xe0,0xbc,0x49,0x4c,
+  0xa7,0x67,0x25,0xad,0xfc,0xc4,0x6e,0x33,0x03,0x22,0x7c,0x1b,0x37,0xf2,0xda,0x75,0xa3,0xd7,0x39,0xd5,
+  0xe8,0x73,0xc7,0xab,0x75,0x6a,0x40,0x48,0xd2,0xaf,0x11,0xaa,0x02,0xe8,0x8c,0x33,0xb5,0xf7,0x05,0x59,
+  0x5e,0xac,0xa3,0x4f,0xa2,0xa8,0x36,0x31,0x30,0x84,0xf8,0xc3,0x8c,0x8e,0xdf,0x31,0xd8,0xe3,0xaf,0x80,
+  0x36,0x9e,0x1c,0x60,0x83,0x70,0x7c,0xeb,0xab,0x9d,0x4d,0x47,0x5b,0xb5,0x34,0xed,0x56,0x04,0x29,0x35,
+  0xd3,0x4a,0xf3,0x74,0xd8,0x4e,0xd0,0x43,0xbd,0x1d,0xac,0xbd,0x2d,0x43,0x5a,0xfb,0x38,0xfc,0xa6,0xb6,
+  0xb6,0x3e,0xd4,0x0d,0x4c,0xec,0x45,0x92,0x45,0xbc,0xb8,0x5e,0xc3,0x2d,0xe9,0xbf,0x78,0xbb,0xff,0xe6,
+  0xc9,0xa1,0x2c,0xb4,0x4a,0xc5,0xca,0x7f,0xb2,0xc0,0xc8,0xaa,0x33,0x31,0x4e,0x92,0xe2,0x31,0x7b,0x42,
+  0x95,0x41,0x7a,0xc5,0xce,0x09,0x26,0x8c,0x05,0xe2,0x0c,0x47,0xf0,0xb8,0x0e,0x85,0x5e,0x71,0xb4,0xaf,
+  0x18,0xba,0x46,0x09,0x7a,0xa1,0x8a,0xeb,0x82,0xb2,0x33,0x5d,0xee,0x95,0xd3,0x29,0x2e,0x2a,0xbc,0x70,
+  0xa9,0x18,0x5d,0xf9,0x4a,0x26,0xc8,0x45,0xe8,0x0b,0xe5,0x9d,0xee,0x17,0xf8,0xb2,0x9a,0xf6,0x8b,0xe4,
+  0xfb,0x7b,0x51,0xb4,0x77,0x8d,0xaf,0x77,0x1d,0x4d,0x01,0xd4,0x71,0x3d,0x91,0xfc,0xd0,0x7f,0xcd,0xdf,
+  0xfc,0xaf,0x0a,0x12,0xbe,0xd5,0x31,0x69,0x2e,0xd8,0xef,0xb7,0x72,0x4e,0xf8,0x1c,0x55,0xf8,0xe8,0xcc,
+  0x93,0xca,0x62,0xea,0x5f,0xed,0xfd,0x01,0xab,0x42,0xaa,0x74,0xcb,0x94,0x56,0xa3,0xc2,0x93,0xd2,0x69,
+  0xfd,0x2d,0xe3,0x50,0xb7,0xb4,0x3f,0x3c,0x2b,0x5b,0xd7,0x2c,0x5d,0xb7,0xd6,0xa5,0xf8,0xcb,0xe7,0x05,
+  0x16,0x39,0xc4,0xff,0x03,0x05,0xe6,0xbc,0x23,0xb0,0x38,0x00,0x00,
+};
+
+// index.html: 4095 B → 1601 B gzip
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xa5,0x57,0xcd,0x6e,0xdb,0x46,0x10,0xbe,0xeb,0x29,
+  0xb6,0x34,0x0a,0xd8,0xad,0x69,0x91,0xb4,0x65,0x5b,0x94,0xc4,0xc2,0x8d,0x9b,0x26,0x68,0x80,0x04,0x56,
+  0xda,0x43,0x6f,0x4b,0x72,0x28,0x6e,0x4d,0x72,0x89,0xdd,0xa5,0x7e,0x6c,0x08,0x68,0x81,0x1e,0x9a,0x7b,
+  0x80,0xbe,0x40,0xdf,0xa4,0xf7,0xe6,0x1d,0xf2,0x24,0x9d,0x5d,0x52,0x36,0xf5,0xdb,0x43,0x7d,0x20,0xc5,
+  0xd9,0xf9,0x9f,0x6f,0x66,0xd6,0xc3,0x2f,0x62,0x1e,0xa9,0x45,0x09,0x24,0x55,0x79,0x16,0x0c,0x9b,0x27,
+  0xd0,0x38,0xe8,0x0c,0x73,0x50,0x94,0x44,0x29,0x15,0x12,0xd4,0xc8,0xaa,0x54,0x62,0x5f,0x5b,0x41,0x4d,
+  0x2d,0x68,0x0e,0x23,0x6b,0xca,0x60,0x56,0x72,0xa1,0x2c,0x12,0xf1,0x42,0x41,0x81,0x5c,0x33,0x16,0xab,
+  0x74,0x14,0xc3,0x94,0x45,0x60,0x9b,0x8f,0x53,0x56,0x30,0xc5,0x68,0x66,0xcb,0x88,0x66,0x30,0x72,0x2d,
+  0xd4,0xac,0x98,0xca,0x20,0xb8,0x01,0xc1,0xc7,0x50,0x48,0x2e,0x86,0xdd,0x9a,0xd2,0x19,0x4a,0xb5,0xd0,
+  0x6f,0x5f,0x70,0xae,0x1e,0x6d,0x3b,0x9c,0xf8,0x47,0x4e,0xe2,0x5e,0x79,0x74,0x60,0xdb,0x09,0x7e,0x40,
+  0x0f,0xae,0x20,0xc4,0x0f,0x1a,0x45,0x68,0xd0,0x3f,0xf2,0xbc,0xa8,0xd7,0x03,0x24,0xe4,0x95,0x82,0xd8,
+  0x3f,0xea,0x5f,0xd0,0xf3,0xf0,0x7a,0xd9,0xf9,0xea,0x31,0xe4,0x73,0x5b,0xb2,0x07,0x56,0x4c,0xfc,0x90,
+  0x8b,0x18,0x84,0x8d,0x94,0x25,0x09,0x79,0xbc,0x78,0xcc,0xa9,0x98,0xb0,0xc2,0x77,0xbd,0x72,0x3e,0x08,
+  0x69,0x74,0x3f,0x11,0xbc,0x2a,0x62,0x7f,0x4a,0xc5,0xb1,0x36,0x7a,0x32,0x88,0x78,0xc6,0x45,0xf3,0x9d,
+  0xe0,0x77,0x82,0x01,0xfa,0xee,0x65,0x39,0xef,0xba,0x67,0x17,0x44,0x2e,0xa4,0x82,0xdc,0xae,0xd8,0xe9,
+  0x18,0x26,0x1c,0xc8,0x8f,0xaf,0x4f,0xef,0x78,0xc8,0x15,0x5f,0x76,0xce,0x22,0x2a,0x62,0xd4,0x3f,0xaf,
+  0xa3,0xf7,0xfb,0xd7,0x0e,0xda,0x68,0xec,0x39,0x84,0x56,0x8a,0x93,0x4d,0xb3,0x47,0xae,0xeb,0x5e,0x7b,
+  0x57,0x83,0xc6,0x4d,0x41,0x63,0x56,0x49,0x63,0x6d,0x50,0xd2,0x38,0xd6,0x11,0xb8,0x17,0xe5,0x1c,0x95,
+  0x0b,0x3e,0x7b,0x8c,0x99,0x2c,0x33,0xba,0xf0,0x93,0x0c,0xe6,0x83,0x09,0x2d,0xfd,0x6b,0xe4,0xd3,0x1f,
+  0xf6,0x4c,0xe0,0x97,0x7e,0x0c,0x68,0xc6,0x26,0x85,0xcd,0xd0,0x49,0xe9,0xeb,0x3c,0x81,0x58,0x76,0xc2,
+  0x4a,0x29,0x5e,0x3c,0x6e,0x85,0x5b,0x67,0x72,0x15,0xf2,0x91,0x73,0xe9,0x35,0x8e,0xf8,0xce,0x93,0x79,
+  0x34,0xd1,0x78,0xbd,0xee,0xa2,0x8e,0x2d,0xaa,0x04,0x96,0xd0,0x2f,0x39,0xd3,0x76,0x4c,0xa6,0xec,0x19,
+  0xb0,0x49,0xaa,0xfc,0x4b,0xc7,0x59,0xd9,0x3d,0x93,0x80,0x20,0x89,0xa9,0x58,0xb4,0x3d,0x38,0xf2,0x7a,
+  0x97,0xe7,0x58,0xcf,0xc6,0x76,0x92,0x24,0x58,0xa0,0x9a,0x7f,0x46,0xc5,0x9a,0xb3,0x47,0x90,0x5c,0xe0,
+  0x5f,0x9b,0xb5,0x93,0xd1,0x10,0xb2,0xa6,0x98,0xb6,0x30,0x26,0x8d,0x97,0xed,0xea,0x19,0x5c,0x9c,0x2c,
+  0x89,0xcc,0x69,0x96,0x3d,0xee,0x38,0xe9,0x1c,0x69,0x8c,0xab,0xc7,0x92,0x4b,0x04,0x2a,0x2f,0x7c,0x01,
+  0x19,0x55,0x6c,0x0a,0x83,0xb4,0x8e,0xe2,0xfc,0x12,0xc3,0x5c,0x92,0x9a,0xcd,0xdb,0xcf,0xe7,0x79,0xcf,
+  0xa5,0xb6,0x15,0x2f,0x8d,0x2f,0xcb,0x0e,0x2b,0xca,0x4a,0x9d,0x4a,0xc8,0x20,0x52,0x6b,0x01,0x39,0xa1,
+  0xeb,0x78,0x4e,0x2b,0xa0,0x55,0xde,0x5d,0xcc,0xb6,0xe4,0x19,0x8b,0x09,0xc2,0xfb,0xfc,0xa9,0x08,0x88,
+  0x07,0x72,0xbd,0x55,0x83,0x6b,0x03,0x8c,0x90,0xc6,0x13,0x78,0x82,0x06,0x2b,0x32,0x56,0x80,0x1d,0x66,
+  0x3c,0xba,0x7f,0x12,0xbf,0xd8,0x29,0xde,0xef,0xf7,0x37,0xc0,0xb8,0xee,0x56,0x3f,0xa2,0xe7,0x74,0x8f,
+  0x67,0xcb,0xce,0xb0,0xdb,0x34,0xec,0xb0,0x6b,0x86,0xc6,0x50,0x77,0x17,0x7e,0xc5,0x6c,0x4a,0xa2,0x8c,
+  0x4a,0x39,0xb2,0x74,0x3f,0x60,0xcf,0x13,0xd2,0x26,0x22,0x8e,0x0d,0x6d,0x9d,0x6a,0x82,0xb0,0xd6,0xe6,
+  0x02,0x9e,0x36,0x7c,0xa6,0x7e,0x84,0xc5,0x23,0x4b,0x2a,0xaa,0x90,0xed,0xf3,0xaf,0x1f,0xd1,0xbc,0xa6,
+  0x6e,0x71,0x40,0x31,0xb5,0x88,0xf1,0x6c,0x64,0x35,0xf5,0xc8,0x20,0x51,0x3a,0x57,0x56,0xf0,0xe9,0x37,
+  0x9f,0xa0,0xec,0x29,0x79,0xd7,0xbc,0xdf,0x37,0xef,0xbb,0x57,0xe6,0x47,0x4b,0xe9,0x93,0xfd,0x4d,0xdf,
+  0x37,0x94,0xeb,0x62,0x5f,0x6a,0xdd,0xb5,0x23,0x35,0x82,0x8d,0x27,0xa1,0x2a,0x7e,0xc6,0x70,0xac,0x40,
+  0x3f,0x87,0xdd,0xfa,0x64,0x27,0xdb,0x18,0xb2,0xc4,0x5a,0xd9,0x78,0x6a,0x16,0x2b,0xd0,0x74,0x5b,0x81,
+  0x54,0x07,0xa5,0xdf,0xf0,0x89,0x45,0x76,0x49,0x2b,0xc4,0x2c,0xc9,0xf8,0x04,0xdd,0x9c,0x1c,0xd4,0x70,
+  0x9b,0xa1,0x82,0x6d,0x0d,0x04,0x31,0x45,0xc3,0x0c,0xe2,0xe0,0x96,0xcf,0x8a,0x8c,0xd3,0x98,0x60,0xc3,
+  0x0b,0x9c,0x18,0x5a,0xeb,0x86,0x46,0xd3,0x8f,0xc1,0xd0,0x20,0xbe,0x2e,0x55,0x8e,0x73,0x3c,0xb5,0x88,
+  0x5e,0x31,0x08,0x85,0x14,0xa2,0x7b,0x1c,0xc2,0x56,0x40,0xc6,0xe6,0x80,0x1c,0xbb,0x8e,0x5d,0xaa,0x93,
+  0x61,0xb7,0x96,0xdc,0x4a,0xb9,0xd6,0x61,0xda,0x0e,0x17,0x4f,0x44,0x8b,0x29,0x95,0x35,0x09,0xb7,0xc8,
+  0xb0,0x5b,0x13,0x82,0x3d,0x12,0xde,0x86,0x88,0xb7,0x2d,0xd2,0xbc,0xf6,0xc0,0x35,0xf5,0xd6,0xab,0x8c,
+  0xd3,0xdb,0x21,0x06,0x41,0x63,0x50,0x0a,0xd3,0x29,0x11,0xf4,0xde,0x01,0x64,0x6f,0x65,0x83,0x15,0x53,
+  0xd0,0xdb,0x72,0x2b,0x1b,0xaf,0xcd,0x01,0xf9,0xe7,0xe3,0x3b,0x22,0x71,0x70,0xb7,0xd2,0xa1,0x61,0x5d,
+  0xd2,0xba,0x48,0xb4,0x9a,0xa3,0x06,0x1d,0x86,0x26,0xb5,0x8d,0x10,0xb3,0x3e,0x47,0x96,0xeb,0x38,0xce,
+  0xd7,0x64,0x44,0x5c,0xf2,0xea,0x81,0xe4,0x10,0x33,0x94,0x44,0x87,0xe4,0x80,0x20,0x13,0x9f,0xe1,0x89,
+  0xa0,0x33,0x22,0x69,0x5e,0x66,0x20,0xc9,0xb1,0x83,0x04,0x40,0xcb,0x8b,0x86,0x74,0x62,0x05,0x88,0xa3,
+  0x86,0xd4,0xf2,0x1b,0x0b,0x9d,0xcb,0x95,0xdb,0x45,0x95,0x87,0x20,0x2c,0x92,0xb3,0x62,0x64,0x39,0xba,
+  0x13,0xa0,0xd4,0x96,0x9f,0x7a,0xa2,0xde,0x7b,0x7a,0xed,0x61,0x64,0xb9,0x5c,0x0f,0xa6,0xfe,0xfd,0x92,
+  0x8b,0x9c,0x2a,0x0c,0xcd,0x0c,0xc5,0x95,0x8d,0x24,0xd7,0x65,0xe6,0xa5,0x1e,0xae,0x64,0x4a,0xb3,0x0a,
+  0x95,0x85,0xac,0xb0,0x82,0x6f,0x59,0x81,0x50,0x1c,0x76,0xeb,0xa3,0x4d,0x96,0x48,0x62,0x4e,0x5e,0x8c,
+  0x7f,0xda,0x77,0x4e,0xe3,0xc8,0x0a,0xee,0x30,0xee,0x9b,0xdb,0x17,0xe4,0x38,0xa2,0xa5,0xaa,0x04,0x9c,
+  0x3c,0x73,0x77,0x6b,0x2f,0x82,0x9d,0x8e,0x66,0x95,0x4c,0xb7,0x13,0x92,0x68,0xf2,0xee,0x8c,0xb8,0xf8,
+  0xa6,0xf3,0x91,0x85,0xab,0x6f,0x23,0x23,0x97,0x17,0x26,0x23,0xbb,0x12,0xb2,0xaa,0xdf,0xdb,0x2c,0xc6,
+  0x46,0xd7,0x8d,0x45,0x24,0x4c,0x72,0x6c,0x32,0x49,0xa8,0x00,0x12,0xa3,0x87,0xb8,0xab,0x08,0xde,0x1d,
+  0x70,0xf8,0x2d,0x08,0xce,0x69,0x10,0x44,0xa5,0x4c,0x12,0x99,0x6a,0x06,0x9e,0x90,0x04,0xf1,0x97,0x5a,
+  0xc1,0x0f,0x00,0xa5,0x56,0x20,0xc9,0xe7,0x0f,0x7f,0xb5,0x7d,0xbe,0xc7,0x83,0x32,0x52,0xbb,0x9d,0x76,
+  0x1a,0xaf,0xfb,0xbd,0x0d,0xa7,0x7b,0x66,0xac,0x91,0x2f,0x0f,0x38,0x7d,0x2b,0x78,0xa9,0x3d,0xa3,0x44,
+  0x43,0xac,0x46,0x12,0xe2,0x4c,0x01,0x99,0xa5,0x0c,0x7f,0xaa,0x14,0xd0,0x43,0x74,0xb5,0xe0,0xe8,0x24,
+  0x9f,0x0d,0x48,0x52,0xe1,0x9c,0x36,0x1c,0xd8,0x9c,0x92,0x63,0xa9,0xf0,0xad,0xc1,0x9f,0xf3,0x29,0x48,
+  0xab,0xdd,0x32,0x34,0xc6,0x7a,0xe1,0x8e,0xdd,0xd1,0x34,0x37,0xcd,0x91,0xd1,0x74,0xc0,0xbf,0x1b,0x26,
+  0x64,0x09,0x98,0x3d,0xb4,0x6d,0x97,0xd8,0xa4,0x78,0x90,0x83,0xbe,0xb2,0x62,0x2e,0x0b,0x35,0x20,0xcd,
+  0xd6,0xd4,0x59,0xc6,0xe7,0xe7,0x0f,0x7f,0x10,0x8f,0xfc,0xfd,0x27,0xf9,0xf4,0x7b,0xdd,0x21,0x55,0x91,
+  0xb0,0x0c,0x6f,0x36,0x78,0x57,0xc0,0xd6,0x37,0x9a,0x6a,0x82,0xe6,0x68,0x83,0x02,0x89,0xfb,0xdb,0xc4,
+  0xa4,0x57,0xf7,0xe7,0xde,0x8e,0x69,0xf0,0xb1,0xbb,0x63,0xc6,0x4a,0x00,0xcd,0xb7,0x91,0x28,0x0d,0x7d,
+  0x8f,0xd9,0xde,0xca,0xae,0xd7,0xb2,0xdb,0xdb,0xb4,0x7b,0xe5,0x1d,0xb0,0xfb,0x1e,0xf2,0x72,0xdb,0xaa,
+  0x32,0x94,0x83,0xf8,0xf7,0x7a,0xbd,0x3d,0xf8,0xaf,0xa7,0xcf,0x2e,0x63,0x6f,0xc7,0x77,0x06,0x06,0xed,
+  0xb9,0xc0,0xa5,0x28,0xad,0xc3,0x4d,0xaa,0xc5,0xde,0x6f,0x0a,0xa9,0xff,0x10,0xfa,0xae,0x98,0xb6,0x23,
+  0xc2,0x1b,0x43,0xfa,0x70,0x30,0xa0,0xad,0x7a,0x35,0xad,0xf1,0xea,0x61,0x5d,0xfd,0xc6,0x56,0xa7,0x1a,
+  0xbb,0x3b,0xf6,0x32,0xd2,0x0f,0xae,0xe3,0x77,0x82,0xef,0xbc,0x0e,0x68,0xba,0xee,0x2a,0x0c,0xfa,0xf0,
+  0x3a,0x87,0xec,0x6d,0xf1,0x6c,0x5a,0xdf,0xa6,0xad,0xe0,0xd6,0xcc,0x11,0x52,0xa7,0x05,0xe2,0x83,0x0a,
+  0xea,0x19,0xbd,0xa1,0xa0,0x19,0xdc,0x2f,0xc7,0x6d,0xd1,0xff,0xb9,0x4d,0x71,0xe5,0xfc,0xd7,0x26,0x6d,
+  0x95,0x56,0x07,0x2f,0x9f,0xef,0x5f,0x78,0xf9,0xaa,0xab,0x61,0x2e,0xe9,0xad,0x9a,0x6f,0x09,0x0a,0x5a,
+  0xe8,0xcb,0xe5,0xc6,0x72,0xc0,0xdb,0x66,0x96,0xed,0xdb,0x1c,0x36,0x0e,0x71,0xdd,0x39,0xc1,0x1b,0x8a,
+  0x53,0xd9,0x75,0x34,0x20,0xf6,0xf2,0x9e,0xaf,0x31,0xa7,0xbc,0x12,0xdb,0x2b,0x66,0x57,0x9e,0xbf,0x07,
+  0xb5,0xab,0xce,0xab,0xdb,0xd6,0xa1,0x44,0xcb,0x48,0xb0,0x52,0x11,0x29,0xa2,0x91,0xd5,0xa5,0x65,0x79,
+  0xf6,0x8b,0xfc,0x66,0x3a,0xba,0x8a,0xe2,0xb8,0xdf,0xbb,0x02,0x8f,0x7a,0xc9,0x79,0xdf,0xed,0x9b,0xa4,
+  0x18,0x4e,0x2d,0x6a,0x2e,0xe8,0x98,0x6e,0xfd,0x8f,0x7e,0xe7,0x5f,0xa5,0x4e,0xe7,0xad,0xff,0x0f,0x00,
+  0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  { "/app.js", "application/javascript", APP_JS_GZ, sizeof(APP_JS_GZ), "\"7cdd957e2a2f3919\"" },
+  { "/", "text/html", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "\"c3e61874ffb3b25b\"" },
+};
@@ -6,264 +6,111 @@
 #include "WebUI.h"
 #include "Shared.h"
 #include "Logging.h"
+#include "LogExport.h"
+#include "LogIndex.h"
 #include "Config.h"
 
 #include <WebServer.h>
 #include <Arduino.h>
 #include <FS.h>
-#include <SPIFFS.h>
+#include "FlashFS.h"
 #include <math.h>
 #include <ESP.h>
 #include <stdlib.h>
 
-#include "SensorMS5525.h"   // doZero(...)
+#include "SensorMS5525.h"   // zeroStart/zeroStatus, OSR
 #include "EnvSensor.h"      // env* globals
+#include "Sampler.h"        // ring stats
+#include "LiveStream.h"     // SSE push
+#include "Snapshot.h"       // pre-serialized /api/sample
+#include "JsonWriter.h"
+#include "History.h"        // /api/history tiers
+#include "WebAssets.h"      // generated: gzip UI assets
+#include "Trace.h"          // record / replay
+#include "Bench.h"          // /api/bench
+#include "Metrics.h"        // /api/metrics
+#include "DpAux.h"          // extra ΔP sensors
+#include "Storage.h"        // rotation / retention
+#include "LogQuery.h"       // /api/query
 
 static void (*saveSettingsFn)() = nullptr;
 
 // Provided in your .ino (for speed gating UI)
 extern bool g_showSpeed;
 
-// ------------------- UI: HTML + JS -------------------
-static const char INDEX_HTML[] PROGMEM = R"HTML(<!doctype html><html><head>
-<meta charset="utf-8"><meta name="viewport" content="width=device-width,initial-scale=1">
-<title>AeroSensor</title>
-<link rel="preconnect" href="https://cdn.jsdelivr.net">
-<style>
-:root{--bg:#0f172a;--fg:#e5e7eb;--accent:#22c55e;--muted:#94a3b8}
-*{box-sizing:border-box} body{margin:12px;background:var(--bg);color:var(--fg);font:16px/1.4 system-ui,Segoe UI,Roboto}
-.card{max-width:980px;margin:0 auto 12px;background:#111827;border-radius:16px;padding:14px}
-.row{display:flex;gap:8px;flex-wrap:wrap;align-items:center}
-button{background:var(--accent);color:#062;border:0;padding:8px 12px;border-radius:10px;cursor:pointer;font-weight:600}
-button.secondary{background:#2563eb;color:#fff} button.warn{background:#ef4444;color:#fff}
-label{margin-right:12px;color:var(--muted)} small{color:var(--muted)}
-#chart{position:relative;height:360px} #chart2{position:relative;height:220px;margin-top:12px}
-input,select{background:#0b1020;color:#fff;border:1px solid #223;padding:6px 8px;border-radius:8px}
-.badge{display:inline-block;padding:4px 8px;border-radius:999px;background:#0b1020;color:#9ca3af;border:1px solid #223}
-</style>
-<script src="https://cdn.jsdelivr.net/npm/chart.js@4.4.1/dist/chart.umd.min.js"></script>
-<script src="https://cdn.jsdelivr.net/npm/chartjs-adapter-date-fns@3"></script>
-</head><body>
-<div class="card">
-  <div class="row">
-    <div class="badge">AeroSensor</div>
-    <small id="state">—</small>
-    <small id="env" style="margin-left:8px">ρ: —, P: —, T: —, RH: —</small>
-  </div>
-  <div class="row" style="margin-top:6px">
-    <button id="btnZero">Zero</button>
-    <button id="btnSelf" class="secondary">Self-test</button>
-    <button id="btnLog"  class="secondary">Start logging</button>
-    <button id="btnDl"   class="secondary" disabled>Download current CSV</button>
-    <label><input id="smooth" type="checkbox"> Smooth (10-pt)</label>
-  </div>
-  <div id="chart"><canvas id="c1"></canvas></div>
-  <div id="chart2"><canvas id="c2"></canvas></div>
-</div>
-
-<div class="card">
-  <h2 style="margin:0 0 8px">Settings</h2>
-  <div class="row">
-    <label><input id="invert" type="checkbox"> Invert ΔP sign</label>
-    <label>Log every <input id="logms" type="number" min="10" step="10" style="width:80px"> ms</label>
-    <button id="btnSave" class="secondary">Save</button>
-    <button id="btnDelOne" class="warn">Delete selected</button>
-    <button id="btnFormat" class="warn">Format FS</button>
-  </div>
-</div>
-
-<div class="card">
-  <h2 style="margin:0 0 8px">Logs</h2>
-  <div class="row">
-    <select id="files" style="min-width:360px"></select>
-    <button id="btnGet" class="secondary">Download</button>
-  </div>
-</div>
-
-<script src="/app.js"></script>
-</body></html>)HTML";
-
-// JS from PROGMEM
-// in WebUI.cpp, replace APP_JS string with this:
-static const char APP_JS[] PROGMEM = R"JS(
-const fmt = v=> (Math.round(v*100)/100).toFixed(2);
-let logging=false, curFile="";
-const live = {t:[], dp:[], va:[], tc:[]};
-
-// Charts
-const baseOpts = {animation:false, maintainAspectRatio:false,
-  plugins:{legend:{display:true}}, scales:{x:{type:'time'}, y:{beginAtZero:false}}};
-const ch1 = new Chart(document.getElementById('c1'), {type:'line',
-  data:{labels:live.t, datasets:[
-    {label:'ΔP (Pa)', data:live.dp, pointRadius:0},
-    {label:'V (m/s)', data:live.va, pointRadius:0, yAxisID:'y1'}
-  ]},
-  options:{...baseOpts, scales:{x:{type:'time'}, y:{position:'left'}, y1:{position:'right'}}}});
-const ch2 = new Chart(document.getElementById('c2'), {type:'line',
-  data:{labels:live.t, datasets:[{label:'Temp (°C)', data:live.tc, pointRadius:0}]}, options:baseOpts});
-
-function setState(s){ document.getElementById('state').textContent = s; }
-
-async function syncTime(){
-  try{
-    const epoch_ms = Date.now();                 // browser wall time
-    const tz_min   = new Date().getTimezoneOffset(); // minutes west of UTC (e.g. Türkiye = -180)
-    await fetch('/api/time',{method:'POST', headers:{'Content-Type':'application/json'},
-      body: JSON.stringify({epoch_ms, tz_min})});
-  }catch(e){ console.warn('time sync failed', e); }
+// ------------------- UI: gzip assets in flash -------------------
+// Sources live in web/; tools/embed_assets.py regenerates WebAssets.h.
+// Strong ETags → 304 on reload; app.js is referenced as /app.js?v=<etag>
+// so the versioned URL can be cached for a year.
+static void sendAsset(WebServer& server, const WebAsset& a){
+  const String v = server.arg("v");
+  const bool versioned = v.length() && ("\"" + v + "\"") == a.etag;
+  server.sendHeader("ETag", a.etag);
+  server.sendHeader("Cache-Control", versioned ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == a.etag) { server.send(304); return; }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, a.type, (const char*)a.gz, a.len);
 }
 
-async function loadSettings(){
-  const r = await fetch('/api/settings'); const s = await r.json();
-  document.getElementById('invert').checked = !!s.invert;
-  document.getElementById('logms').value   = s.logms;
+// from/to query args: unix ms; negative = ms before now (from=-600000 → last 10 min)
+static uint64_t argTime(WebServer& server, const char* k, uint64_t def){
+  if (!server.hasArg(k)) return def;
+  long long v = atoll(server.arg(k).c_str());
+  if (v < 0) v += g_timeOffsetMs + (long long)millis();
+  return v < 0 ? 0 : (uint64_t)v;
 }
 
-async function refreshFiles(){
-  const r = await fetch('/api/files'); const j = await r.json();
-  const sel = document.getElementById('files'); sel.innerHTML='';
-  (j.files||[]).forEach(f=>{
-    const name = (typeof f === 'string') ? f : f.name;
-    const size = (typeof f === 'object' && f.size!=null) ? ` (${f.size} B)` : '';
-    const o=document.createElement('option'); o.value=name; o.textContent=name+size; sel.appendChild(o);
-  });
+static String argFile(WebServer& server){
+  String fn = server.hasArg("file") ? server.arg("file") : String("");
+  if (fn.length() && fn.charAt(0) != '/') fn = "/" + fn;
+  return fn;
 }
 
-async function poll(){
-  try{
-    const r = await fetch('/api/sample'); if(!r.ok) throw 0;
-    const j = await r.json();
-
-    logging = !!j.logging; curFile = j.curFile || "";
-    document.getElementById('btnLog').textContent = logging? 'Stop logging' : 'Start logging';
-    document.getElementById('btnDl').disabled = !curFile;
-
-    setState(`ΔP=${fmt(j.dp)} Pa, V=${fmt(j.va)} m/s, T=${fmt(j.tc)} °C${logging? ' — logging → '+curFile:''}`);
-
-    // env
-    if (typeof j.rho === 'number' && typeof j.ap === 'number' && typeof j.at === 'number') {
-      const env = document.getElementById('env');
-      const hpa = (j.ap/100).toFixed(1);
-      const rh  = (j.hasH && typeof j.ah === 'number') ? `, RH=${j.ah.toFixed(0)}%` : '';
-      env.textContent = `ρ=${j.rho.toFixed(3)} kg/m³, P=${hpa} hPa, T=${j.at.toFixed(1)} °C${rh}`;
-    }
-
-    // Use real timestamp `ts` (epoch ms from device)
-    const t = new Date(j.ts || j.t); // fallback to t if ts absent
-    const sm = document.getElementById('smooth').checked;
-    live.t.push(t); live.dp.push(sm? j.dp_s : j.dp); live.va.push(j.va); live.tc.push(sm? j.tc_s : j.tc);
-    if (live.t.length>1200){ live.t.shift(); live.dp.shift(); live.va.shift(); live.tc.shift(); }
-    ch1.update(); ch2.update();
-  }catch(e){ setState('disconnected…'); }
-  setTimeout(poll, 200);
+// ------------------- Endpoints -------------------
+// Handlers run in the HTTP task: API endpoints touch app-task state, so they
+// run under AppLock (short — streaming replies are bounded JSON/text).
+// Assets, /api/sample (seqlock), /download (export worker), the FS-only
+// /api/files and /api/query, and /api/bench don't need it; /api/history
+// takes it per chunk of points.
+static void onLocked(WebServer& server, const char* uri, HTTPMethod m, std::function<void()> fn){
+  server.on(uri, m, [fn](){ AppLock g; fn(); });
 }
 
-// SAVE
-document.getElementById('btnSave').onclick = async ()=>{
-  try{
-    const invert = document.getElementById('invert').checked;
-    const logms  = +document.getElementById('logms').value;
-    const r = await fetch('/api/settings',{
-      method:'POST', headers:{'Content-Type':'application/json'},
-      body: JSON.stringify({ invert, logms })
-    });
-    if(!r.ok) throw new Error('save failed');
-    alert(`Saved ✓\nLog period: ${logms} ms\nInvert ΔP: ${invert ? 'on' : 'off'}`);
-  }catch(e){ console.error(e); alert('Save failed'); }
-};
-
-document.getElementById('btnZero').onclick = async ()=>{
-  if (!confirm('Zero differential pressure sensor?\n\nMake sure both ports are open to still air.')) return;
-  const btn = document.getElementById('btnZero');
-  btn.disabled = true;
-  setState('zeroing…');
-  try {
-    const r = await fetch('/api/zero',{method:'POST'});
-    const j = await r.json();
-    if (!r.ok || !j.ok) throw new Error('zero failed');
-    setState('zeroed');
-    alert(`Zero completed ✓\nSamples: ${j.samples}\nNew dp_zero: ${j.dp_zero.toFixed(4)} Pa`);
-  } catch(e) {
-    console.error(e);
-    setState('zero failed');
-    alert('Zero failed ❌');
-  } finally {
-    btn.disabled = false;
-  }
-};
-
-document.getElementById('btnLog').onclick  = async ()=>{
-  try{
-    const cmd = logging? 'stop' : 'start';
-    const r = await fetch('/api/log?cmd='+cmd,{method:'POST'});
-    const j = await r.json();
-    if (j.error) { alert(`Logging error: ${j.error}${j.fs_total? `\nFS: ${j.fs_used}/${j.fs_total}`:''}`); }
-    logging = !!j.logging; 
-    curFile = j.curFile || "";
-    document.getElementById('btnLog').textContent = logging? 'Stop logging' : 'Start logging';
-    document.getElementById('btnDl').disabled = !curFile;
-    setTimeout(refreshFiles, 200);
-  }catch(e){ console.error(e); alert('Logging command failed'); }
-};
-
-document.getElementById('btnDl').onclick   = ()=>{ if (curFile) location.href='/download?file='+encodeURIComponent(curFile); };
-
-document.getElementById('btnDelOne').onclick= async ()=>{
-  const f=document.getElementById('files').value;
-  if(!f){ alert('Select a file first'); return; }
-  if(!confirm('Delete '+f+' ?')) return;
-  try{
-    const r = await fetch('/api/delete?file='+encodeURIComponent(f),{method:'POST'});
-    const j = await r.json();
-    if (!j.ok) alert('Delete failed');
-    refreshFiles();
-  }catch(e){ console.error(e); alert('Delete failed'); }
-};
-
-document.getElementById('btnFormat').onclick= async ()=>{
-  if(!confirm('FORMAT the filesystem and reboot? All files will be erased.')) return;
-  try{
-    await fetch('/api/format',{method:'POST'});
-    alert('Formatted; device will reboot…');
-    setTimeout(()=>location.reload(), 4000);
-  }catch(e){ console.error(e); alert('Format failed'); }
-};
-
-document.getElementById('btnGet').onclick  = ()=>{
-  const f=document.getElementById('files').value;
-  if(f) location.href='/download?file='+encodeURIComponent(f);
-};
-
-// Kickoff
-(async()=>{ await syncTime(); await loadSettings(); await refreshFiles(); poll(); })();
-)JS";
-
-// ------------------- Endpoints -------------------
 void setupHTTP(WebServer& server, void (*saveSettingsCb)()) {
   saveSettingsFn = saveSettingsCb;
 
-  // UI + JS
-  server.on("/", HTTP_GET, [&](){ server.send_P(200, "text/html", INDEX_HTML); });
-  server.on("/app.js", HTTP_GET, [&](){ server.send_P(200, "application/javascript", APP_JS); });
+  // UI + JS (pre-compressed, cacheable)
+  static const char* COLLECT[] = { "If-None-Match" };
+  server.collectHeaders(COLLECT, 1);
+  for (const WebAsset& a : WEB_ASSETS)
+    server.on(a.path, HTTP_GET, [&server, &a](){ sendAsset(server, a); });
 
 
 
-  // Zero (works with doZero(ms) that returns void)
-server.on("/api/zero", HTTP_POST, [&](){
-  stopLogging();
-  uint16_t n=0;
-  bool ok = doZero(2000, &n);
-  if (saveSettingsFn) saveSettingsFn();
-  String j = "{";
-  j += "\"ok\":" + String(ok ? "true" : "false") + ",";
-  j += "\"dp_zero\":" + String(dp_zero, 4) + ",";
-  j += "\"samples\":" + String((unsigned)n);
-  j += "}";
-  server.send(200, "application/json", j);
-});
+  // Zero: start a background job (sampling, HTTP and logging keep running)
+  onLocked(server, "/api/zero", HTTP_POST, [&](){
+    uint16_t ms = server.hasArg("ms") ? (uint16_t)server.arg("ms").toInt() : 2000;
+    bool ok = zeroStart(ms);
+    server.send(ok ? 202 : 409, "application/json",
+                String("{\"ok\":") + (ok?"true":"false") + ",\"running\":true}");
+  });
+
+  // Zero job progress/status
+  onLocked(server, "/api/zero", HTTP_GET, [&](){
+    ZeroStatus st; zeroStatus(st);
+    String j = "{";
+    j += "\"running\":"  + String(st.running ? "true" : "false") + ",";
+    j += "\"done\":"     + String(st.done ? "true" : "false") + ",";
+    j += "\"ok\":"       + String(st.ok ? "true" : "false") + ",";
+    j += "\"progress\":" + String((unsigned)st.progress) + ",";
+    j += "\"samples\":"  + String((unsigned)st.samples) + ",";
+    j += "\"dp_zero\":"  + String(dp_zero, 4);
+    j += "}";
+    server.send(200, "application/json", j);
+  });
 
   // Logging control
-  server.on("/api/log", HTTP_POST, [&](){
+  onLocked(server, "/api/log", HTTP_POST, [&](){
     String cmd = server.hasArg("cmd") ? server.arg("cmd") : "";
     if      (cmd=="start") startLogging();
     else if (cmd=="stop")  stopLogging();
@@ -271,12 +118,12 @@ server.on("/api/zero", HTTP_POST, [&](){
 
     String name = currentLogName();
     if (cmd=="start" && !loggingOn) {
-      size_t total = SPIFFS.totalBytes();
-      size_t used  = SPIFFS.usedBytes();
+      size_t total = FLASHFS.totalBytes();
+      size_t used  = FLASHFS.usedBytes();
       String j = "{";
       j += "\"logging\":false,";
       j += "\"curFile\":\"\",";
-      j += "\"error\":\"open failed (FS metadata likely full)\",";
+      j += "\"error\":\"open failed (FS full even after retention)\",";
       j += "\"fs_total\":" + String((unsigned long)total) + ",";
       j += "\"fs_used\":"  + String((unsigned long)used)  + "}";
       server.send(200, "application/json", j);
@@ -288,145 +135,319 @@ server.on("/api/zero", HTTP_POST, [&](){
     server.send(200, "application/json", j);
   });
 
+  // Log writer health (rows written / dropped, RAM buffer fill)
+  onLocked(server, "/api/log", HTTP_GET, [&](){
+    LogStats st; logStats(st);
+    StorageStats fs; storageStats(fs);
+    const String name = currentLogName();
+    char buf[384];
+    JsonWriter j(buf, sizeof(buf));
+    j.obj()
+     .kvb("logging",   loggingOn)
+     .kvs("curFile",   name.c_str())
+     .kvb("raw",       logEveryMs < LOG_RAW_BELOW_MS)
+     .kvu("rows",      st.rows)
+     .kvu("dropped",   st.dropped)
+     .kvu("buffered",  st.buffered)
+     .kvu("capacity",  st.capacity)
+     .kvu("segments",  st.segments)
+     .kvu("fs_total",  fs.total)
+     .kvu("fs_used",   fs.used)
+     .kvu("fs_budget", fs.budget)
+     .kvu("retention_deleted", fs.deleted)
+     .end();
+    server.send_P(200, "application/json", j.c_str(), j.length());
+  });
+
   // Files & download
-  server.on("/api/files", HTTP_GET, [&](){ listFilesJSON(server); });
+  server.on("/api/files", HTTP_GET, [&](){ listFilesJSON(server); });   // FS only: no AppLock
   // Receive browser wall time and compute offset
-server.on("/api/time", HTTP_POST, [&](){
-  long long epoch_ms = 0;
-  int tz_min = 0;
-  if (server.hasArg("plain")) {
-    String body = server.arg("plain");
-    int i, c;
-
-    if ((i = body.indexOf("\"epoch_ms\"")) != -1) {
-      c = body.indexOf(':', i);
-      // parse as 64-bit
-      String v = body.substring(c+1);
-      v.trim();
-      epoch_ms = atoll(v.c_str());
+  onLocked(server, "/api/time", HTTP_POST, [&](){
+    long long epoch_ms = 0;
+    int tz_min = 0;
+    if (server.hasArg("plain")) {
+      String body = server.arg("plain");
+      int i, c;
+
+      if ((i = body.indexOf("\"epoch_ms\"")) != -1) {
+        c = body.indexOf(':', i);
+        // parse as 64-bit
+        String v = body.substring(c+1);
+        v.trim();
+        epoch_ms = atoll(v.c_str());
+      }
+      if ((i = body.indexOf("\"tz_min\"")) != -1) {
+        c = body.indexOf(':', i);
+        tz_min = body.substring(c+1).toInt();
+      }
     }
-    if ((i = body.indexOf("\"tz_min\"")) != -1) {
-      c = body.indexOf(':', i);
-      tz_min = body.substring(c+1).toInt();
+    if (epoch_ms > 0) {
+      g_timeOffsetMs = epoch_ms - (long long)millis();
+      g_tzOffsetMin  = tz_min;
+      server.send(200, "application/json",
+        String("{\"ok\":true,\"offset_ms\":") + g_timeOffsetMs + ",\"tz_min\":" + g_tzOffsetMin + "}");
+    } else {
+      server.send(400, "application/json", "{\"ok\":false}");
     }
-  }
-  if (epoch_ms > 0) {
-    g_timeOffsetMs = epoch_ms - (long long)millis();
-    g_tzOffsetMin  = tz_min;
-    server.send(200, "application/json",
-      String("{\"ok\":true,\"offset_ms\":") + g_timeOffsetMs + ",\"tz_min\":" + g_tzOffsetMin + "}");
-  } else {
-    server.send(400, "application/json", "{\"ok\":false}");
-  }
-});
-
-// Live sample JSON — add ts (epoch ms)
-server.on("/api/sample", HTTP_GET, [&](){
-  Sample s; s.t_ms=lastS.t_ms; s.dp_Pa=lastS.dp_Pa; s.temp_C=lastS.temp_C; s.Va_mps=lastS.Va_mps;
-  String cur = currentLogName();
-  unsigned long t_ms = (unsigned long)s.t_ms;
-  unsigned long long ts = (unsigned long long)g_timeOffsetMs + (unsigned long long)t_ms;
-
-  String j = "{";
-  j += "\"t\":"   + String(t_ms) + ",";                    // legacy ms
-  j += "\"ts\":"  + String((unsigned long long)ts) + ",";
-  j += "\"dp\":"  + String(s.dp_Pa, 4) + ",";
-  j += "\"tc\":"  + String(s.temp_C, 3) + ",";
-  j += "\"va\":"  + String(s.Va_mps, 4) + ",";
-  j += "\"rho\":" + String(rho, 4) + ",";
-  j += "\"ap\":"  + String(isnan(envP_Pa)?0:envP_Pa, 1) + ",";
-  j += "\"at\":"  + String(isnan(envT_C)?0:envT_C, 2) + ",";
-  j += "\"ah\":"  + String(isnan(envRH)?0:envRH, 1) + ",";
-  j += "\"hasH\":"+ String(envHasHum ? "true" : "false") + ",";
-  // smoothing
-  static float adp=0, atc=0; static int n=0; n = min(10, n+1);
-  adp += (s.dp_Pa - adp)/n; atc += (s.temp_C - atc)/n;
-  j += "\"dp_s\":" + String(adp, 4) + ",";
-  j += "\"tc_s\":" + String(atc, 4) + ",";
-  j += "\"logging\":" + String(loggingOn ? "true" : "false") + ",";
-  j += "\"curFile\":\"" + cur + "\"}";
-  server.send(200, "application/json", j);
-});
-
-  // Files & download (no stopLogging)
-// Files & download (no stopLogging)
-server.on("/download", HTTP_GET, [&](){
-  String fn = server.hasArg("file") ? server.arg("file") : String("");
-  if (fn.length() && fn.charAt(0) != '/') fn = "/" + fn;
-  if (fn.length()==0 || !SPIFFS.exists(fn)) { server.send(404, "text/plain", "no such file"); return; }
-
-  // try direct read while logging (no stopLogging)
-  File f = SPIFFS.open(fn, FILE_READ);
-  if (!f) {
-    // fallback: snapshot copy if concurrent open fails
-    String snap = "/_snap.csv";
-    if (SPIFFS.exists(snap)) SPIFFS.remove(snap);
-
-    File src = SPIFFS.open(fn, FILE_READ);
-    File dst = SPIFFS.open(snap, FILE_WRITE);
-    if (src && dst) {
-      uint8_t buf[1024];
-      int n;
-      while ((n = src.read(buf, sizeof(buf))) > 0) dst.write(buf, n);
-      src.close(); dst.close();
-      f = SPIFFS.open(snap, FILE_READ);
-    }
-    if (!f) { server.send(500, "text/plain", "open failed"); return; }
-  }
+  });
+
+  // Live push stream (SSE): batched frames with every sample
+  onLocked(server, "/api/stream", HTTP_GET, [&](){ liveStreamAttach(server); });
+
+  // Live sample JSON — add ts (epoch ms) (polling fallback)
+  // Served as-is from the pre-serialized snapshot: no per-request formatting
+  server.on("/api/sample", HTTP_GET, [&](){   // seqlock snapshot: no AppLock needed
+    char buf[SNAPSHOT_BUF];
+    size_t n = snapshotCopy(buf, sizeof(buf));
+    if (!n) { server.send(503, "application/json", "{\"error\":\"busy\"}"); return; }
+    server.send_P(200, "application/json", buf, n);
+  });
 
-  // Suggest a file name to the browser (strip leading '/')
-  server.sendHeader("Content-Disposition",
-                  "attachment; filename=\"" + fn.substring(1) + "\"");
+  // History tiers: /api/history?res=1|10|60&since=<unix ms, negative = ago>
+  // (copies the points under AppLock in chunks, streams without it)
+  server.on("/api/history", HTTP_GET, [&](){ historyJSON(server); });
+
+  // Download: /download?file=…[&from=…&to=…][&fmt=csv|bin][&zero=…&pscale=…&invert=0|1][&tail=1]
+  // from/to are unix ms (negative = ms before now, e.g. from=-600000 → last
+  // 10 min). Seeks via the .idx index, converts on the fly, chunked transfer.
+  // zero/pscale/invert re-apply a corrected zero or scale to capture (.adc) logs.
+  // The connection is handed to an export worker; the server moves on at once.
+  server.on("/download", HTTP_GET, [&](){
+    const String fn = argFile(server);
+    if (fn.length()==0 || !FLASHFS.exists(fn)) { server.send(404, "text/plain", "no such file"); return; }
+
+    LogExportReq r;
+    r.fn   = fn;
+    r.from = argTime(server, "from", 0);
+    r.to   = argTime(server, "to", UINT64_MAX);
+    r.fmt  = (server.hasArg("fmt") && server.arg("fmt") == "bin") ? LOG_FMT_BIN : LOG_FMT_CSV;
+    if (server.hasArg("zero"))   r.adc.zero   = server.arg("zero").toFloat();
+    if (server.hasArg("pscale")) r.adc.pscale = server.arg("pscale").toFloat();
+    if (server.hasArg("invert")) r.adc.invert = server.arg("invert").toInt() ? 1 : 0;
+    r.tail = server.hasArg("tail") && server.arg("tail") != "0";
+    if (!logExportSubmit(server, r)) server.send(503, "text/plain", "too many downloads");
+  });
 
-  // streamFile will set Content-Type and Content-Length automatically
-  server.streamFile(f, "text/csv");
-  f.close();
-});
+  // Aggregates over a time range without downloading:
+  // /api/query?file=…[&from=…&to=…][&agg=min,max,mean,sum,count]
+  // → {"rows":…,"spans":…,"scanned":…,"dp_Pa":{"min":…,…},"Va_mps":{…},"rho_kgm3":{…}}
+  // Reads only the .idx and the edge spans (LogQuery.h); no app state → no AppLock.
+  server.on("/api/query", HTTP_GET, [&](){
+    const String fn = argFile(server);
+    if (fn.length()==0 || !FLASHFS.exists(fn)) { server.send(404, "text/plain", "no such file"); return; }
+    const uint64_t from = argTime(server, "from", 0);
+    const uint64_t to   = argTime(server, "to", UINT64_MAX);
+    LogQueryResult q;
+    if (!logQuery(fn, from, to, q)) { server.send(500, "text/plain", "bad log header"); return; }
+
+    const String agg = server.hasArg("agg") ? server.arg("agg") : String("min,max,mean,count");
+    char buf[640];
+    JsonWriter j(buf, sizeof(buf));
+    j.obj().kvs("file", fn.c_str()).kvu("from", from).kvu("to", to)
+     .kvu("rows", q.rows).kvu("spans", q.spans).kvu("scanned", q.scanned);
+    for (uint8_t k = 0; k < LOG_IDX_CH; k++) {
+      const LogQueryCh& c = q.ch[k];
+      j.obj(LOG_IDX_COLS[k]);
+      if (agg.indexOf("min")   != -1) j.kvf("min",  c.n ? c.min : NAN, 4);
+      if (agg.indexOf("max")   != -1) j.kvf("max",  c.n ? c.max : NAN, 4);
+      if (agg.indexOf("mean")  != -1) j.kvf("mean", c.n ? (float)(c.sum / c.n) : NAN, 4);
+      if (agg.indexOf("sum")   != -1) j.kvf("sum",  (float)c.sum, 4);
+      if (agg.indexOf("count") != -1) j.kvu("count", c.n);
+      j.end();
+    }
+    j.end();
+    server.send_P(200, "application/json", j.c_str(), j.length());
+  });
 
   // Delete selected file (any file)
-  server.on("/api/delete", HTTP_POST, [&](){
+  onLocked(server, "/api/delete", HTTP_POST, [&](){
     String fn = server.hasArg("file") ? server.arg("file") : String("");
     if (fn.length() && fn.charAt(0) != '/') fn = "/" + fn;
+    if (storagePinned(fn.c_str())) { server.send(409, "application/json", "{\"ok\":false,\"error\":\"download in progress\"}"); return; }
     if (fn==currentLogName()) stopLogging();
     bool ok=false;
-    if (fn.length() && SPIFFS.exists(fn)) ok = SPIFFS.remove(fn);
+    if (fn.length() && FLASHFS.exists(fn)) ok = FLASHFS.remove(fn);
+    String ix = logIndexPath(fn);
+    if (ok && ix != fn && FLASHFS.exists(ix)) FLASHFS.remove(ix);
     server.send(200, "application/json", String("{\"ok\":") + (ok?"true":"false") + "}");
   });
 
   // FORMAT FS (danger) + reboot
-  server.on("/api/format", HTTP_POST, [&](){
+  onLocked(server, "/api/format", HTTP_POST, [&](){
     stopLogging();
-    bool ok = SPIFFS.format();
+    bool ok = FLASHFS.format();
     server.send(200, "application/json", String("{\"formatted\":") + (ok?"true":"false") + "}");
     delay(250);
     ESP.restart();
   });
 
   // Settings (GET/POST)
-  server.on("/api/settings", HTTP_GET, [&](){
-    String j = "{";
-    j += "\"invert\":" + String(invertDP ? "true" : "false") + ",";
-    j += "\"logms\":"  + String(logEveryMs) + ",";
-    j += "\"dp_zero\":" + String(dp_zero, 4);
-    j += "}";
-    server.send(200, "application/json", j);
+  onLocked(server, "/api/settings", HTTP_GET, [&](){
+    char buf[512];
+    JsonWriter j(buf, sizeof(buf));
+    j.obj()
+     .kvb("invert",   invertDP)
+     .kvu("logms",    logEveryMs)
+     .kvs("logfmt",   logFormat == LOG_FMT_ADC ? "adc" : logFormat == LOG_FMT_BIN ? "bin" : "csv")
+     .kvu("flushms",  logFlushMs)
+     .kvu("keeppct",  logKeepPct)
+     .kvb("adaptive", adaptiveRate)
+     .kvu("filtms",   airFilterMs)
+     .kvu("streamms", liveFrameMs)
+     .kvu("tevery",   sensorTempEvery())
+     .kvu("osr_p",    sensorOsrRatio(sensorOsrP()))
+     .kvu("osr_t",    sensorOsrRatio(sensorOsrT()))
+     .kvu("envhz",    envRateHz())
+     .kvf("dp_zero",  dp_zero, 4);
+    j.arr("aux");                              // extra ΔP sensors (DP_AUX)
+    for (uint8_t i = 0; i < dpAuxCount(); i++)
+      j.obj().kvb("online", dpAuxOnline(i)).kvb("invert", dpAuxInvert[i]).kvf("zero", dpAuxZero[i], 4).end();
+    j.end().end();
+    server.send_P(200, "application/json", j.c_str(), j.length());
   });
 
-  server.on("/api/settings", HTTP_POST, [&](){
+  onLocked(server, "/api/settings", HTTP_POST, [&](){
+    // a profile sweep owns the OSR until it restores the configured one
+    if (sensorProfileRunning()) { server.send(409, "application/json", "{\"error\":\"OSR profile running\"}"); return; }
     if (server.hasArg("plain")) {
       String body = server.arg("plain");
       bool ninv = invertDP; 
       uint32_t nms = logEveryMs;
+      uint8_t  nfmt = logFormat;
+      uint32_t nfl  = logFlushMs;
+      long     nkp  = logKeepPct;
+      bool     nad  = adaptiveRate;
+      long     nfm  = airFilterMs;
+      uint32_t nsm  = liveFrameMs;
+      long nte = sensorTempEvery();
+      uint8_t nop = sensorOsrP(), not_ = sensorOsrT();
+      long neh = envRateHz();
       int i;
       if ((i = body.indexOf("\"invert\""))!=-1){ int c = body.indexOf(':', i); ninv = body.substring(c+1, c+6).indexOf("true")!=-1; }
       if ((i = body.indexOf("\"logms\""))!=-1) { int c = body.indexOf(':', i); nms  = (uint32_t) body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"logfmt\""))!=-1){ int c = body.indexOf(':', i); String v = body.substring(c+1, c+8);
+                                                 nfmt = v.indexOf("adc")!=-1 ? LOG_FMT_ADC : v.indexOf("bin")!=-1 ? LOG_FMT_BIN : LOG_FMT_CSV; }
+      if ((i = body.indexOf("\"flushms\""))!=-1){ int c = body.indexOf(':', i); nfl = (uint32_t) body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"keeppct\""))!=-1){ int c = body.indexOf(':', i); nkp = body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"adaptive\""))!=-1){ int c = body.indexOf(':', i); nad = body.substring(c+1, c+6).indexOf("true")!=-1; }
+      if ((i = body.indexOf("\"filtms\""))!=-1){ int c = body.indexOf(':', i); nfm = body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"streamms\""))!=-1){ int c = body.indexOf(':', i); nsm = (uint32_t) body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"tevery\""))!=-1){ int c = body.indexOf(':', i); nte  = body.substring(c+1).toInt(); }
+      if ((i = body.indexOf("\"osr_p\""))!=-1) { int c = body.indexOf(':', i); nop  = sensorOsrFromRatio(body.substring(c+1).toInt()); }
+      if ((i = body.indexOf("\"osr_t\""))!=-1) { int c = body.indexOf(':', i); not_ = sensorOsrFromRatio(body.substring(c+1).toInt()); }
+      if ((i = body.indexOf("\"envhz\""))!=-1) { int c = body.indexOf(':', i); neh  = body.substring(c+1).toInt(); }
+      for (uint8_t k = 0; k < dpAuxCount(); k++) {             // "dp1_inv" … per extra sensor
+        char key[12]; snprintf(key, sizeof(key), "\"dp%u_inv\"", k + 1);
+        if ((i = body.indexOf(key))!=-1) { int c = body.indexOf(':', i); dpAuxInvert[k] = body.substring(c+1, c+6).indexOf("true")!=-1; }
+      }
       invertDP   = ninv;
-      logEveryMs = max<uint32_t>(10, nms);
+      logEveryMs = nms;                          // < 1000 → raw rows, 0 = every sample
+      logFormat  = nfmt;                         // applies to the next log file
+      logFlushMs = constrain<uint32_t>(nfl, 1000, 600000);
+      logKeepPct = (uint8_t)constrain(nkp, 10L, 95L);  // retention applies from the next check
+      adaptiveRate = nad;                        // sampler switches on its next sample
+      airFilterMs  = (uint16_t)constrain(nfm, 0L, (long)AIR_FILTER_MAX_MS);
+      liveFrameMs= constrain<uint32_t>(nsm, 50, 2000);
+      sensorSetTempEvery((uint8_t)constrain(nte, 1L, 255L));
+      sensorSetOsr(nop, not_);
+      envSetRateHz((uint8_t)constrain(neh, 1L, (long)ENV_MAX_HZ));
       if (saveSettingsFn) saveSettingsFn();
     }
     server.send(200, "text/plain", "OK");
   });
 
+  // Acquisition ring health
+  onLocked(server, "/api/sampler", HTTP_GET, [&](){
+    SamplerStats st; samplerStats(st);
+    String j = "{";
+    j += "\"produced\":"   + String((unsigned long)st.produced)  + ",";
+    j += "\"overflows\":"  + String((unsigned long)st.overflows) + ",";
+    j += "\"high_water\":" + String((unsigned long)st.highWater) + ",";
+    j += "\"depth\":"      + String((unsigned long)st.depth)     + ",";
+    j += "\"capacity\":"   + String((unsigned long)st.capacity)  + "}";
+    server.send(200, "application/json", j);
+  });
+
+  // Traces: POST cmd=record[&s=<seconds>]|replay|stop [&file=/trace.csv]
+  onLocked(server, "/api/trace", HTTP_POST, [&](){
+    const String cmd = server.arg("cmd");
+    String fn = server.hasArg("file") ? server.arg("file") : String("/trace.csv");
+    if (fn.charAt(0) != '/') fn = "/" + fn;
+    bool ok = true;
+    if      (cmd == "record") ok = traceRecordStart(fn.c_str(), server.hasArg("s") ? server.arg("s").toInt() : 60);
+    else if (cmd == "replay") ok = traceReplayStart(fn.c_str());
+    else if (cmd == "stop")   { traceRecordStop(); traceReplayStop(); }
+    else { server.send(400, "application/json", "{\"error\":\"bad cmd\"}"); return; }
+    server.send(ok ? 200 : 409, "application/json", ok ? "{\"ok\":true}" : "{\"ok\":false}");
+  });
+
+  onLocked(server, "/api/trace", HTTP_GET, [&](){
+    TraceStatus st; traceStatus(st);
+    char buf[512];
+    JsonWriter j(buf, sizeof(buf));
+    j.obj().kvb("recording", st.recording).kvu("rec_rows", st.recRows)
+     .kvb("replaying", st.replaying).kvb("done", st.done)
+     .kvu("rows", st.rows).kvu("elapsed_ms", st.elapsedMs).kvu("trace_ms", st.traceMs)
+     .kvf("sps", st.elapsedMs ? st.rows * 1000.0f / st.elapsedMs : 0.0f, 1)
+     .kvu("bins", st.bins).kvu("log_rows", st.logRows).kvu("nudges", st.nudges)
+     .kvu("gate_on", st.gateOn).kvu("gate_off", st.gateOff)
+     .kvu("onsets", st.onsets).kvu("missed", st.missed)
+     .kvu("latency_mean_ms", st.latMeanMs).kvu("latency_max_ms", st.latMaxMs)
+     .kvu("filter_ms", airFilterMs)
+     .kvf("dp_zero_end", st.dpZeroEnd, 4).end();
+    server.send_P(200, "application/json", j.c_str(), j.length());
+  });
+
+  // Stage latency histograms, I2C errors, heap (Prometheus text)
+  onLocked(server, "/api/metrics", HTTP_GET, [&](){ metricsText(server); });
+
+  // Hot-path microbenchmarks (cycles per op): scratch inputs only, no AppLock
+  server.on("/api/bench", HTTP_GET, [&](){ benchJSON(server); });
+
+  // Oversampling: live rate/noise + per-OSR profile sweep
+  onLocked(server, "/api/osr", HTTP_GET, [&](){
+    float sps, noise; sensorRateNoise(sps, noise);
+    String j = "{";
+    j += "\"osr_p\":"    + String((unsigned)sensorOsrRatio(sensorOsrP())) + ",";
+    j += "\"osr_t\":"    + String((unsigned)sensorOsrRatio(sensorOsrT())) + ",";
+    j += "\"sps\":"      + String(sps, 1) + ",";
+    j += "\"noise_Pa\":" + String(noise, 3) + ",";
+    j += "\"profiling\":" + String(sensorProfileRunning() ? "true" : "false") + ",";
+    j += "\"profile\":[";
+    OsrProfile res[MS5525_OSR_COUNT];
+    uint8_t n = sensorProfileResults(res, MS5525_OSR_COUNT);
+    for (uint8_t k=0; k<n; k++) {
+      if (k) j += ",";
+      j += "{\"osr\":"     + String((unsigned)res[k].osr) +
+           ",\"conv_us\":" + String((unsigned long)res[k].conv_us) +
+           ",\"sps\":"     + String(res[k].sps, 1) +
+           ",\"noise_Pa\":"+ String(res[k].noise_Pa, 3) +
+           ",\"samples\":" + String((unsigned long)res[k].samples) + "}";
+    }
+    j += "]}";
+    server.send(200, "application/json", j);
+  });
+
+  onLocked(server, "/api/osr/profile", HTTP_POST, [&](){
+    uint16_t ms = server.hasArg("ms") ? (uint16_t)server.arg("ms").toInt() : MS5525_PROFILE_MS;
+    bool ok = sensorProfileStart(ms);
+    server.send(ok ? 200 : 409, "application/json", String("{\"ok\":") + (ok?"true":"false") + "}");
+  });
+
   server.onNotFound([&](){ server.send(404, "text/plain", "404"); });
   server.begin();
-}
\ No newline at end of file
+}
+
+// ------------------- HTTP task -------------------
+static void httpTask(void* arg){
+  WebServer& server = *(WebServer*)arg;
+  for (;;) {
+    { StageTimer t(STAGE_HTTP); server.handleClient(); }
+    vTaskDelay(1);   // ≤ 1 tick to pick up a request, whatever the app task does
+  }
+}
+
+void httpBegin(WebServer& server){
+  logExportBegin();
+  xTaskCreatePinnedToCore(httpTask, "http", HTTP_STACK, &server, HTTP_PRIO, nullptr, APP_CORE);
+}
@@ -4,4 +4,9 @@
 class WebServer;
 
 // Builds endpoints and serves UI. Call from setup().
-void setupHTTP(WebServer& server, void (*saveSettingsCb)());
\ No newline at end of file
+void setupHTTP(WebServer& server, void (*saveSettingsCb)());
+
+// HTTP task (APP_CORE, HTTP_PRIO): handleClient() every tick, independent of
+// the app loop. API handlers hold AppLock; /download is handed to an export
+// worker and /api/stream to the live stream, so neither occupies the server.
+void httpBegin(WebServer& server);
\ No newline at end of file
@@ -0,0 +1,19 @@
+// aero_bench: the /api/bench suite (Bench.cpp) on the host. The mock cycle
+// counter runs at 1 GHz, so cycles read as ns of this machine.
+//   aero_bench [n]
+#include "../Bench.h"
+#include "../Config.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+  uint32_t n = argc > 1 ? (uint32_t)atol(argv[1]) : BENCH_DEFAULT_N;
+  if (n < 1) n = 1;
+  if (n > BENCH_MAX_N) n = BENCH_MAX_N;
+  BenchResult res[BENCH_CASES];
+  float base;
+  const uint8_t k = benchRun(n, res, BENCH_CASES, base);
+  printf("n %lu, baseline %.1f ns/op\n", (unsigned long)n, (double)base);
+  for (uint8_t i = 0; i < k; i++) printf("%-16s %8.1f ns/op\n", res[i].name, (double)res[i].cycles);
+  return k == BENCH_CASES ? 0 : 1;
+}
@@ -0,0 +1,21 @@
+#pragma once
+// Minimal checks for the host tests: a failed CHECK prints and counts, the
+// test's main() returns checkDone().
+#include <math.h>
+#include <stdio.h>
+
+static int checkFails = 0;
+
+#define CHECK(c) do { if (!(c)) { \
+    fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #c); checkFails++; } } while (0)
+
+#define CHECK_NEAR(a, b, tol) do { const double a_ = (a), b_ = (b); \
+    if (!(fabs(a_ - b_) <= (tol))) { \
+      fprintf(stderr, "%s:%d: %s = %.6g, expected %.6g ± %.3g\n", __FILE__, __LINE__, #a, a_, b_, (double)(tol)); \
+      checkFails++; } } while (0)
+
+static inline int checkDone(const char* name) {
+  if (checkFails) fprintf(stderr, "%s: %d check(s) failed\n", name, checkFails);
+  else printf("%s: ok\n", name);
+  return checkFails ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+#include <Arduino.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass       ESP;
+
+// ---------- virtual clock ----------
+static std::atomic<uint64_t> clockUs{0};
+
+void     hostClockSet(uint64_t us)     { clockUs = us; }
+void     hostClockAdvance(uint64_t us) { clockUs += us; }
+uint64_t hostClockUs()                 { return clockUs; }
+
+uint32_t millis()                   { return (uint32_t)(clockUs / 1000); }
+uint32_t micros()                   { return (uint32_t)clockUs; }
+void     delay(uint32_t ms)         { clockUs += (uint64_t)ms * 1000; std::this_thread::yield(); }
+void     delayMicroseconds(uint32_t us) { clockUs += us; }
+void     yield()                    { std::this_thread::yield(); }
+int64_t  esp_timer_get_time()       { return (int64_t)clockUs; }
+
+// ---------- Serial / ESP ----------
+static bool serialEcho = false;
+void hostSerialEcho(bool on) { serialEcho = on; }
+
+size_t HardwareSerial::write(const uint8_t* p, size_t n) {
+  if (serialEcho) fwrite(p, 1, n, stdout);
+  return n;
+}
+
+size_t Print::printf(const char* fmt, ...) {
+  char buf[512];
+  va_list ap; va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n < 0) return 0;
+  if ((size_t)n < sizeof(buf)) return write((const uint8_t*)buf, n);
+  std::string big(n + 1, 0);
+  va_start(ap, fmt); vsnprintf(&big[0], big.size(), fmt, ap); va_end(ap);
+  return write((const uint8_t*)big.data(), n);
+}
+
+void EspClass::restart() { fprintf(stderr, "ESP.restart() on the host\n"); exit(3); }
+
+uint32_t EspClass::getCycleCount() {
+  using namespace std::chrono;
+  return (uint32_t)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ---------- FreeRTOS ----------
+BaseType_t xTaskCreatePinnedToCore(void (*fn)(void*), const char*, uint32_t, void* arg,
+                                   UBaseType_t, TaskHandle_t* out, BaseType_t) {
+  std::thread t(fn, arg);
+  if (out) *out = (TaskHandle_t)(uintptr_t)std::hash<std::thread::id>()(t.get_id());
+  t.detach();
+  return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+  clockUs += (uint64_t)ticks * 1000;
+  std::this_thread::sleep_for(std::chrono::microseconds(ticks ? 50 : 0));
+}
+
+void vTaskDelete(TaskHandle_t t) {
+  // Only a task deleting itself is supported: park the thread
+  if (!t) for (;;) std::this_thread::sleep_for(std::chrono::hours(1));
+}
+
+TickType_t  xTaskGetTickCount()                        { return millis(); }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t)  { return 0; }
+uint32_t    xPortGetCoreID()                           { return 0; }
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new std::timed_mutex; }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t m, TickType_t wait) {
+  auto* mx = (std::timed_mutex*)m;
+  if (wait == portMAX_DELAY) { mx->lock(); return pdTRUE; }
+  return mx->try_lock_for(std::chrono::milliseconds(wait)) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t m) { ((std::timed_mutex*)m)->unlock(); return pdTRUE; }
+
+namespace {
+struct Queue {
+  std::mutex mx;
+  std::condition_variable cv;
+  std::deque<std::vector<uint8_t>> items;
+  size_t len, size;
+};
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t itemSize) {
+  Queue* q = new Queue;
+  q->len = len; q->size = itemSize;
+  return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t h, const void* item, TickType_t) {
+  Queue* q = (Queue*)h;
+  {
+    std::lock_guard<std::mutex> g(q->mx);
+    if (q->items.size() >= q->len) return pdFAIL;   // no blocking senders on the host
+    const uint8_t* p = (const uint8_t*)item;
+    q->items.emplace_back(p, p + q->size);
+  }
+  q->cv.notify_one();
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t h, void* item, TickType_t wait) {
+  Queue* q = (Queue*)h;
+  std::unique_lock<std::mutex> g(q->mx);
+  auto ready = [q] { return !q->items.empty(); };
+  if (wait == portMAX_DELAY) q->cv.wait(g, ready);
+  else if (!q->cv.wait_for(g, std::chrono::milliseconds(wait), ready)) return pdFALSE;
+  memcpy(item, q->items.front().data(), q->size);
+  q->items.pop_front();
+  return pdTRUE;
+}
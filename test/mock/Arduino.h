@@ -0,0 +1,147 @@
+#pragma once
+// Host stand-in for the ESP32 Arduino core: just what the sketch uses.
+// Time is virtual (hostClock*): millis()/micros() only move when a test
+// advances them or code calls delay(), so replays are deterministic.
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define F(x) x
+#define IRAM_ATTR
+using std::min; using std::max;
+template<class T, class L, class H> T constrain(T v, L lo, H hi) { return v < (T)lo ? (T)lo : (v > (T)hi ? (T)hi : v); }
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// Virtual clock (µs since "boot")
+void     hostClockSet(uint64_t us);
+void     hostClockAdvance(uint64_t us);
+uint64_t hostClockUs();
+
+class String {
+public:
+  String() {}
+  String(const char* c) : s_(c ? c : "") {}
+  String(const std::string& x) : s_(x) {}
+  explicit String(char c) : s_(1, c) {}
+  String(int v)                { s_ = std::to_string(v); }
+  String(unsigned v)           { s_ = std::to_string(v); }
+  String(long v)               { s_ = std::to_string(v); }
+  String(unsigned long v)      { s_ = std::to_string(v); }
+  String(long long v)          { s_ = std::to_string(v); }
+  String(unsigned long long v) { s_ = std::to_string(v); }
+  String(double v, unsigned char d = 2) { char b[48]; snprintf(b, sizeof(b), "%.*f", d, v); s_ = b; }
+
+  const char* c_str() const { return s_.c_str(); }
+  size_t length() const { return s_.size(); }
+  bool   isEmpty() const { return s_.empty(); }
+  void   reserve(size_t n) { s_.reserve(n); }
+  char   charAt(size_t i) const { return i < s_.size() ? s_[i] : 0; }
+  char   operator[](size_t i) const { return charAt(i); }
+
+  String substring(size_t a) const { return a < s_.size() ? String(s_.substr(a)) : String(); }
+  String substring(size_t a, size_t b) const {
+    if (b > s_.size()) b = s_.size();
+    return a < b ? String(s_.substr(a, b - a)) : String();
+  }
+  int indexOf(char c, size_t from = 0) const { return pos(s_.find(c, from)); }
+  int indexOf(const char* x, size_t from = 0) const { return pos(s_.find(x, from)); }
+  int indexOf(const String& x, size_t from = 0) const { return pos(s_.find(x.s_, from)); }
+  int lastIndexOf(char c) const { return pos(s_.rfind(c)); }
+  int lastIndexOf(const char* x) const { return pos(s_.rfind(x)); }
+
+  long  toInt() const { return atol(s_.c_str()); }
+  float toFloat() const { return (float)atof(s_.c_str()); }
+  void  trim() {
+    const size_t a = s_.find_first_not_of(" \t\r\n");
+    if (a == std::string::npos) { s_.clear(); return; }
+    s_ = s_.substr(a, s_.find_last_not_of(" \t\r\n") - a + 1);
+  }
+  void remove(size_t i) { if (i < s_.size()) s_.erase(i); }
+  void remove(size_t i, size_t n) { if (i < s_.size()) s_.erase(i, n); }
+  void toLowerCase() { for (char& c : s_) c = (char)tolower((unsigned char)c); }
+  bool startsWith(const char* x) const { return s_.rfind(x, 0) == 0; }
+  bool startsWith(const String& x) const { return startsWith(x.c_str()); }
+  bool endsWith(const char* x) const {
+    const size_t n = strlen(x);
+    return s_.size() >= n && s_.compare(s_.size() - n, n, x) == 0;
+  }
+  bool endsWith(const String& x) const { return endsWith(x.c_str()); }
+  bool equals(const char* x) const { return s_ == x; }
+  bool equals(const String& x) const { return s_ == x.s_; }
+
+  String& operator+=(const String& o) { s_ += o.s_; return *this; }
+  String& operator+=(const char* o) { s_ += o; return *this; }
+  String& operator+=(char c) { s_ += c; return *this; }
+  template<class N> String& operator+=(N v) { return *this += String(v); }
+  bool concat(const String& o) { s_ += o.s_; return true; }
+  bool concat(const char* o) { s_ += o; return true; }
+
+  bool operator==(const String& o) const { return s_ == o.s_; }
+  bool operator==(const char* o) const { return s_ == o; }
+  bool operator!=(const String& o) const { return s_ != o.s_; }
+  bool operator!=(const char* o) const { return s_ != o; }
+  bool operator<(const String& o) const { return s_ < o.s_; }
+
+  const std::string& str() const { return s_; }
+
+private:
+  static int pos(size_t p) { return p == std::string::npos ? -1 : (int)p; }
+  std::string s_;
+};
+inline String operator+(const String& a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, const char* b) { String r(a); r += b; return r; }
+inline String operator+(const char* a, const String& b) { String r(a); r += b; return r; }
+inline String operator+(const String& a, char b) { String r(a); r += b; return r; }
+template<class N> String operator+(const String& a, N b) { String r(a); r += String(b); return r; }
+
+// printf/print/println on top of a byte sink
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) { return write(&c, 1); }
+  virtual size_t write(const uint8_t* p, size_t n) = 0;
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  template<class N> size_t print(N v) { return print(String(v)); }
+  size_t println() { return write("\r\n"); }
+  template<class T> size_t println(const T& v) { return print(v) + println(); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long) {}
+  using Print::write;
+  size_t write(const uint8_t* p, size_t n) override;
+};
+extern HardwareSerial Serial;
+// Serial output is dropped unless set (tests keep their stdout clean)
+void hostSerialEcho(bool on);
+
+struct EspClass {
+  void     restart();
+  uint32_t getFreeHeap()    { return 200000; }
+  uint32_t getMinFreeHeap() { return 150000; }
+  uint32_t getMaxAllocHeap(){ return 110000; }
+  // 1 GHz host "cycle" counter from the real monotonic clock: cycles == ns
+  uint32_t getCycleCount();
+  uint32_t getCpuFreqMHz()  { return 1000; }
+};
+extern EspClass ESP;
+
+#include "freertos.h"
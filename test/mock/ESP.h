@@ -0,0 +1,2 @@
+#pragma once
+#include <Arduino.h>   // EspClass ESP lives there, as in the ESP32 core
@@ -0,0 +1,10 @@
+#pragma once
+#include <Arduino.h>
+
+class MDNSResponder {
+public:
+  bool begin(const char*) { return true; }
+  void addService(const char*, const char*, uint16_t) {}
+  void end() {}
+};
+extern MDNSResponder MDNS;
@@ -0,0 +1,187 @@
+#include <FS.h>
+#include <SPIFFS.h>
+#include <LittleFS.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+SPIFFSFS   SPIFFS;
+LittleFSFS LittleFS;
+
+static std::string root = "_hostfs";
+static size_t      total = 1536 * 1024;   // default "spiffs" partition of a 4 MB board
+
+void        hostFsRoot(const char* dir) { root = dir; }
+const char* hostFsRoot()                { return root.c_str(); }
+void        hostFsTotal(size_t bytes)   { total = bytes; }
+
+static std::string hostPath(const char* p) {
+  std::string s = root;
+  if (!p || *p != '/') s += '/';
+  return s + (p ? p : "");
+}
+
+namespace fs {
+
+struct FileImpl {
+  FILE*       f = nullptr;
+  std::string path;      // FS path ("/name")
+  std::string base;      // basename
+  bool        dir = false;
+  std::vector<std::string> entries;
+  size_t      next = 0;
+  ~FileImpl() { if (f) fclose(f); }
+};
+
+File::operator bool() const { return p_ && (p_->f || p_->dir); }
+
+size_t File::write(const uint8_t* buf, size_t n) {
+  if (!p_ || !p_->f) return 0;
+  return fwrite(buf, 1, n, p_->f);
+}
+
+int File::read() {
+  if (!p_ || !p_->f) return -1;
+  clearerr(p_->f);                  // EOF is not sticky: the writer may append more
+  const int c = fgetc(p_->f);
+  return c == EOF ? -1 : c;
+}
+
+size_t File::read(uint8_t* buf, size_t n) {
+  if (!p_ || !p_->f) return 0;
+  // re-sync the stdio buffer with the file: another handle may have appended
+  clearerr(p_->f);
+  fseek(p_->f, 0, SEEK_CUR);
+  return fread(buf, 1, n, p_->f);
+}
+
+int File::peek() {
+  const int c = read();
+  if (c >= 0) fseek(p_->f, -1, SEEK_CUR);
+  return c;
+}
+
+int File::available() {
+  if (!p_ || !p_->f) return 0;
+  const long pos = ftell(p_->f);
+  return (int)(size() - (size_t)pos);
+}
+
+void File::flush() { if (p_ && p_->f) fflush(p_->f); }
+
+void File::close() { p_.reset(); }
+
+size_t File::size() const {
+  if (!p_ || !p_->f) return 0;
+  fflush(p_->f);
+  struct stat st;
+  return fstat(fileno(p_->f), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+size_t File::position() const { return p_ && p_->f ? (size_t)ftell(p_->f) : 0; }
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!p_ || !p_->f) return false;
+  const int wh = mode == SeekCur ? SEEK_CUR : mode == SeekEnd ? SEEK_END : SEEK_SET;
+  return fseek(p_->f, (long)pos, wh) == 0;
+}
+
+const char* File::name() const { return p_ ? p_->base.c_str() : ""; }
+const char* File::path() const { return p_ ? p_->path.c_str() : ""; }
+bool File::isDirectory() const { return p_ && p_->dir; }
+
+File File::openNextFile(const char* mode) {
+  if (!p_ || !p_->dir) return File();
+  while (p_->next < p_->entries.size()) {
+    File f = SPIFFS.open(("/" + p_->entries[p_->next++]).c_str(), mode);
+    if (f) return f;
+  }
+  return File();
+}
+
+time_t File::getLastWrite() {
+  if (!p_ || !p_->f) return 0;
+  struct stat st;
+  return fstat(fileno(p_->f), &st) == 0 ? st.st_mtime : 0;
+}
+
+size_t File::readBytesUntil(char term, char* buf, size_t n) {
+  size_t k = 0;
+  while (k < n) {
+    const int c = read();
+    if (c < 0 || c == term) break;
+    buf[k++] = (char)c;
+  }
+  return k;
+}
+
+String File::readStringUntil(char term) {
+  std::string s;
+  for (int c; (c = read()) >= 0 && c != term;) s += (char)c;
+  return String(s);
+}
+
+File FS::open(const char* path, const char* mode, bool) {
+  auto p = std::make_shared<FileImpl>();
+  p->path = path;
+  const char* slash = strrchr(path, '/');
+  p->base = slash ? slash + 1 : path;
+  const std::string hp = hostPath(path);
+
+  struct stat st;
+  if (!strcmp(path, "/") || (stat(hp.c_str(), &st) == 0 && S_ISDIR(st.st_mode))) {
+    DIR* d = opendir(hp.c_str());
+    if (!d) return File();
+    for (dirent* e; (e = readdir(d));) if (e->d_name[0] != '.') p->entries.push_back(e->d_name);
+    closedir(d);
+    std::sort(p->entries.begin(), p->entries.end());
+    p->dir = true;
+    return File(p);
+  }
+  const char* m = !strcmp(mode, FILE_WRITE) ? "wb" : !strcmp(mode, FILE_APPEND) ? "ab" : "rb";
+  p->f = fopen(hp.c_str(), m);
+  return p->f ? File(p) : File();
+}
+
+bool FS::exists(const char* path) {
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) { return ::remove(hostPath(path).c_str()) == 0; }
+
+bool FS::rename(const char* from, const char* to) {
+  return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0;
+}
+
+} // namespace fs
+
+bool HostFlashFS::begin(bool, const char*, uint8_t, const char*) {
+  mkdir(root.c_str(), 0755);
+  struct stat st;
+  return stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+size_t HostFlashFS::totalBytes() { return total; }
+
+size_t HostFlashFS::usedBytes() {
+  size_t used = 0;
+  DIR* d = opendir(root.c_str());
+  if (!d) return 0;
+  for (dirent* e; (e = readdir(d));) {
+    struct stat st;
+    if (e->d_name[0] != '.' && stat(hostPath(e->d_name).c_str(), &st) == 0) used += st.st_size;
+  }
+  closedir(d);
+  return used;
+}
+
+bool HostFlashFS::format() {
+  DIR* d = opendir(root.c_str());
+  if (!d) return false;
+  for (dirent* e; (e = readdir(d));)
+    if (e->d_name[0] != '.') ::remove(hostPath(e->d_name).c_str());
+  closedir(d);
+  return true;
+}
@@ -0,0 +1,81 @@
+#pragma once
+// fs::FS / fs::File over a host directory (hostFsRoot). Like SPIFFS, the
+// namespace is flat: "/name" maps to <root>/name, and two handles on one file
+// see each other's data once it is flushed.
+#include <Arduino.h>
+#include <memory>
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+namespace fs {
+
+struct FileImpl;
+
+class File : public Print {
+public:
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> p) : p_(std::move(p)) {}
+  operator bool() const;
+
+  using Print::write;
+  size_t write(const uint8_t* buf, size_t n) override;
+  int    read();
+  size_t read(uint8_t* buf, size_t n);
+  int    peek();
+  int    available();
+  void   flush();
+  void   close();
+  size_t size() const;
+  size_t position() const;
+  bool   seek(uint32_t pos, SeekMode mode = SeekSet);
+  const char* name() const;     // basename, like the ESP32 core 2.x
+  const char* path() const;
+  bool   isDirectory() const;
+  File   openNextFile(const char* mode = FILE_READ);
+  time_t getLastWrite();
+  size_t readBytes(char* buf, size_t n) { return read((uint8_t*)buf, n); }
+  size_t readBytesUntil(char term, char* buf, size_t n);
+  String readStringUntil(char term);
+
+private:
+  std::shared_ptr<FileImpl> p_;
+};
+
+class FS {
+public:
+  File open(const char* path, const char* mode = FILE_READ, bool create = false);
+  File open(const String& path, const char* mode = FILE_READ, bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char* path);
+  bool exists(const String& path) { return exists(path.c_str()); }
+  bool remove(const char* path);
+  bool remove(const String& path) { return remove(path.c_str()); }
+  bool rename(const char* from, const char* to);
+  bool rename(const String& from, const String& to) { return rename(from.c_str(), to.c_str()); }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+// Flash filesystem backing store: a host directory (created on begin())
+void        hostFsRoot(const char* dir);
+const char* hostFsRoot();
+// Reported partition size (usedBytes() is the sum of the file sizes)
+void        hostFsTotal(size_t bytes);
+
+class HostFlashFS : public fs::FS {
+public:
+  bool   begin(bool formatOnFail = false, const char* base = "/spiffs", uint8_t maxOpen = 10,
+               const char* label = nullptr);
+  size_t totalBytes();
+  size_t usedBytes();
+  bool   format();
+  void   end() {}
+};
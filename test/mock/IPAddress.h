@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+
+class IPAddress {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : b_{a, b, c, d} {}
+  String toString() const {
+    char s[16];
+    snprintf(s, sizeof(s), "%u.%u.%u.%u", b_[0], b_[1], b_[2], b_[3]);
+    return String(s);
+  }
+  uint8_t operator[](int i) const { return b_[i]; }
+private:
+  uint8_t b_[4];
+};
@@ -0,0 +1,4 @@
+#pragma once
+#include <FS.h>
+class LittleFSFS : public HostFlashFS {};
+extern LittleFSFS LittleFS;
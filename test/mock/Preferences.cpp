@@ -0,0 +1,29 @@
+#include <Preferences.h>
+
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> store;
+
+void hostPrefsClear() { store.clear(); }
+
+bool Preferences::clear() { store[ns_].clear(); return true; }
+bool Preferences::remove(const char* key) { return store[ns_].erase(key) != 0; }
+bool Preferences::isKey(const char* key) { return store[ns_].count(key) != 0; }
+
+size_t Preferences::putBytes(const char* key, const void* p, size_t n) {
+  const uint8_t* b = (const uint8_t*)p;
+  store[ns_][key].assign(b, b + n);
+  return n;
+}
+
+size_t Preferences::getBytes(const char* key, void* p, size_t n) {
+  auto& m = store[ns_];
+  auto it = m.find(key);
+  if (it == m.end() || it->second.size() > n) return 0;
+  memcpy(p, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+  auto& m = store[ns_];
+  auto it = m.find(key);
+  return it == m.end() ? 0 : it->second.size();
+}
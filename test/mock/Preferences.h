@@ -0,0 +1,42 @@
+#pragma once
+// NVS namespace in a process-wide map (survives Preferences objects, not the
+// process). hostPrefsClear() wipes every namespace.
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences {
+public:
+  bool begin(const char* ns, bool readOnly = false) { ns_ = ns; return true; }
+  void end() {}
+  bool clear();
+  bool remove(const char* key);
+  bool isKey(const char* key);
+
+  size_t putBytes(const char* key, const void* p, size_t n);
+  size_t getBytes(const char* key, void* p, size_t n);
+  size_t getBytesLength(const char* key);
+
+  size_t   putFloat (const char* k, float v)    { return put(k, v); }
+  size_t   putBool  (const char* k, bool v)     { return put(k, v); }
+  size_t   putUChar (const char* k, uint8_t v)  { return put(k, v); }
+  size_t   putUShort(const char* k, uint16_t v) { return put(k, v); }
+  size_t   putInt   (const char* k, int32_t v)  { return put(k, v); }
+  size_t   putUInt  (const char* k, uint32_t v) { return put(k, v); }
+  float    getFloat (const char* k, float d = 0)    { return get(k, d); }
+  bool     getBool  (const char* k, bool d = false) { return get(k, d); }
+  uint8_t  getUChar (const char* k, uint8_t d = 0)  { return get(k, d); }
+  uint16_t getUShort(const char* k, uint16_t d = 0) { return get(k, d); }
+  int32_t  getInt   (const char* k, int32_t d = 0)  { return get(k, d); }
+  uint32_t getUInt  (const char* k, uint32_t d = 0) { return get(k, d); }
+
+private:
+  template<class T> size_t put(const char* k, T v) { return putBytes(k, &v, sizeof(v)); }
+  template<class T> T get(const char* k, T d) {
+    T v;
+    return getBytesLength(k) == sizeof(T) && getBytes(k, &v, sizeof(v)) == sizeof(v) ? v : d;
+  }
+  std::string ns_;
+};
+
+void hostPrefsClear();
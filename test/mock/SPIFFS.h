@@ -0,0 +1,4 @@
+#pragma once
+#include <FS.h>
+class SPIFFSFS : public HostFlashFS {};
+extern SPIFFSFS SPIFFS;
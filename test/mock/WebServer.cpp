@@ -0,0 +1,29 @@
+#include <WebServer.h>
+
+void WebServer::send(int code, const char* type, const String& body) {
+  reply_.code = code;
+  reply_.type = type ? type : "";
+  reply_.body = body.str();
+}
+
+void WebServer::send_P(int code, const char* type, const char* p, size_t n) {
+  reply_.code = code;
+  reply_.type = type ? type : "";
+  reply_.body.assign(p, n);
+}
+
+void WebServer::sendContent(const char* p, size_t n) { reply_.body.append(p, n); }
+
+HostReply WebServer::request(HTTPMethod m, const char* uri,
+                             const std::map<std::string, std::string>& args,
+                             const std::map<std::string, std::string>& headers) {
+  reply_ = HostReply();
+  reply_.sock = std::make_shared<HostSocket>();
+  args_ = args; hdrs_ = headers; uri_ = uri; method_ = m; length_ = 0;
+  for (const Route& r : routes_) {
+    if (r.uri == uri && (r.m == HTTP_ANY || r.m == m)) { r.fn(); return reply_; }
+  }
+  if (notFound_) notFound_();
+  else send(404, "text/plain", "Not found");
+  return reply_;
+}
@@ -0,0 +1,67 @@
+#pragma once
+// WebServer with the handler table of the ESP32 one and no network: a test
+// calls request() and gets the reply (send/sendContent, or whatever was
+// written to client(), which handlers may keep — SSE, export workers).
+#include <WiFi.h>
+#include <FS.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+struct HostReply {
+  int         code = 0;        // 0: handler sent nothing through send()
+  std::string type, body;
+  std::map<std::string, std::string> headers;
+  std::shared_ptr<HostSocket> sock;   // the request's connection
+};
+
+class WebServer {
+public:
+  typedef std::function<void()> THandler;
+  explicit WebServer(int port = 80) {}
+
+  void on(const char* uri, HTTPMethod m, THandler fn) { routes_.push_back({uri, m, fn}); }
+  void on(const char* uri, THandler fn) { on(uri, HTTP_ANY, fn); }
+  void onNotFound(THandler fn) { notFound_ = fn; }
+  void begin() {}
+  void handleClient() {}
+  void collectHeaders(const char**, size_t) {}
+
+  void send(int code, const char* type = nullptr, const String& body = String());
+  void send(int code, const char* type, const char* body) { send(code, type, String(body)); }
+  void send_P(int code, const char* type, const char* p, size_t n);
+  void send_P(int code, const char* type, const char* p) { send_P(code, type, p, strlen(p)); }
+  void sendHeader(const String& k, const String& v, bool = false) { reply_.headers[k.str()] = v.str(); }
+  void setContentLength(size_t n) { length_ = n; }
+  void sendContent(const String& s) { sendContent(s.c_str(), s.length()); }
+  void sendContent(const char* p, size_t n);
+  void sendContent_P(const char* p, size_t n) { sendContent(p, n); }
+
+  bool   hasArg(const char* k) const { return args_.count(k) != 0; }
+  bool   hasArg(const String& k) const { return hasArg(k.c_str()); }
+  String arg(const char* k) const { auto it = args_.find(k); return it == args_.end() ? String() : String(it->second); }
+  String arg(const String& k) const { return arg(k.c_str()); }
+  bool   hasHeader(const char* k) const { return hdrs_.count(k) != 0; }
+  String header(const char* k) const { auto it = hdrs_.find(k); return it == hdrs_.end() ? String() : String(it->second); }
+  String uri() const { return String(uri_); }
+  HTTPMethod method() const { return method_; }
+  WiFiClient client() { return WiFiClient(reply_.sock); }
+
+  // Host side: run the handler for one request ("body" is the "plain" arg)
+  HostReply request(HTTPMethod m, const char* uri,
+                    const std::map<std::string, std::string>& args = {},
+                    const std::map<std::string, std::string>& headers = {});
+
+private:
+  struct Route { std::string uri; HTTPMethod m; THandler fn; };
+  std::vector<Route> routes_;
+  THandler notFound_;
+  std::map<std::string, std::string> args_, hdrs_;
+  std::string uri_;
+  HTTPMethod  method_ = HTTP_GET;
+  HostReply   reply_;
+  size_t      length_ = 0;
+};
@@ -0,0 +1,71 @@
+#include <WiFi.h>
+#include <ESPmDNS.h>
+#include <errno.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass     WiFi;
+MDNSResponder MDNS;
+
+// A loopback TCP connection, so send buffers fill and short writes happen
+// the way they do on lwIP
+HostSocket::HostSocket() {
+  signal(SIGPIPE, SIG_IGN);         // a send to a closed peer fails with EPIPE, as with lwIP
+  sockaddr_in a{};
+  socklen_t   al = sizeof(a);
+  a.sin_family      = AF_INET;
+  a.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  const int l = socket(AF_INET, SOCK_STREAM, 0);
+  const int rcv = 4096;             // a small receive window: a reader that doesn't read is felt soon
+  setsockopt(l, SOL_SOCKET, SO_RCVBUF, &rcv, sizeof(rcv));
+  if (l >= 0 && bind(l, (sockaddr*)&a, sizeof(a)) == 0 && listen(l, 1) == 0 &&
+      getsockname(l, (sockaddr*)&a, &al) == 0) {
+    fd[0] = socket(AF_INET, SOCK_STREAM, 0);
+    const int mss = 536;            // lwIP's default TCP_MSS: frames span segments
+    setsockopt(fd[0], IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+    if (connect(fd[0], (sockaddr*)&a, sizeof(a)) == 0) fd[1] = accept(l, nullptr, nullptr);
+    if (fd[1] >= 0) fcntl(fd[1], F_SETFL, fcntl(fd[1], F_GETFL) | O_NONBLOCK);
+  }
+  if (l >= 0) close(l);
+}
+
+HostSocket::~HostSocket() {
+  for (int f : fd) if (f >= 0) close(f);
+}
+
+const std::string& HostSocket::drain() {
+  char buf[4096];
+  for (ssize_t n; fd[1] >= 0 && (n = read(fd[1], buf, sizeof(buf))) > 0;) out.append(buf, n);
+  return out;
+}
+
+void HostSocket::setSendBuf(int bytes) { setsockopt(fd[0], SOL_SOCKET, SO_SNDBUF, &bytes, sizeof(bytes)); }
+
+void HostSocket::hangUp() {
+  if (fd[1] >= 0) close(fd[1]);
+  fd[1] = -1;
+}
+
+void WiFiClient::stop() {
+  if (!s_ || !s_->open) return;
+  s_->open = false;
+  shutdown(s_->fd[0], SHUT_WR);
+}
+
+// Blocking like the core's write(), with a peer that keeps up: a full send
+// buffer is drained into out() and the rest goes after it
+size_t WiFiClient::write(const uint8_t* p, size_t n) {
+  size_t done = 0;
+  while (connected() && done < n) {
+    const ssize_t w = send(s_->fd[0], p + done, n - done, MSG_DONTWAIT);
+    if (w > 0) done += w;
+    else if (w < 0 && errno == EAGAIN && s_->fd[1] >= 0) s_->drain();
+    else break;
+  }
+  return done;
+}
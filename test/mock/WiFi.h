@@ -0,0 +1,50 @@
+#pragma once
+// WiFiClient on a host loopback connection: copies share one connection (as on the
+// ESP32), fd() is the sketch's end of it. A test reads what was sent with
+// drain(), shrinks the send buffer with setSendBuf() or hangs up the peer.
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <memory>
+#include <string>
+
+#define WIFI_AP 2
+
+struct HostSocket {
+  std::string out;                  // everything drain() has read so far
+  bool        open = true;
+  int         fd[2] = { -1, -1 };   // [0] the sketch's end, [1] the peer's
+  HostSocket();
+  ~HostSocket();
+  const std::string& drain();       // read what is pending at the peer into out
+  void setSendBuf(int bytes);       // SO_SNDBUF of the sketch's end
+  void hangUp();                    // close the peer: further sends fail
+};
+
+class WiFiClient : public Print {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(std::shared_ptr<HostSocket> s) : s_(std::move(s)) {}
+  operator bool() const { return s_ && s_->open; }
+  bool connected() const { return s_ && s_->open; }
+  using Print::write;
+  size_t write(const uint8_t* p, size_t n) override;
+  int  fd() const { return s_ ? s_->fd[0] : -1; }
+  void stop();
+  void setNoDelay(bool) {}
+  void flush() {}
+  int  available() { return 0; }
+  int  read() { return -1; }
+  std::shared_ptr<HostSocket> socket() const { return s_; }
+private:
+  std::shared_ptr<HostSocket> s_;
+};
+
+class WiFiClass {
+public:
+  void mode(int) {}
+  bool softAPConfig(IPAddress, IPAddress, IPAddress) { return true; }
+  bool softAP(const char*, const char*) { return true; }
+  void setSleep(bool) {}
+  IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+};
+extern WiFiClass WiFi;
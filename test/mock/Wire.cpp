@@ -0,0 +1,29 @@
+#include <Wire.h>
+
+TwoWire Wire(0);
+TwoWire Wire1(1);
+
+void TwoWire::attach(uint8_t addr, HostI2cDevice* d) {
+  for (Slot& s : devs_) if (s.addr == addr) { s.dev = d; return; }
+  devs_.push_back({addr, d});
+}
+
+HostI2cDevice* TwoWire::dev(uint8_t addr) const {
+  for (const Slot& s : devs_) if (s.addr == addr) return s.dev;
+  return nullptr;
+}
+
+uint8_t TwoWire::endTransmission(bool stop) {
+  HostI2cDevice* d = dev(addr_);
+  const uint8_t rc = d ? d->write(tx_.data(), tx_.size(), stop) : 2;
+  tx_.clear();
+  return rc;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t n, uint8_t) {
+  rx_.assign(n, 0); rxPos_ = 0;
+  HostI2cDevice* d = dev(addr);
+  const size_t got = d ? d->read(rx_.data(), n) : 0;
+  rx_.resize(min(got, (size_t)n));
+  return (uint8_t)rx_.size();
+}
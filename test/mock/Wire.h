@@ -0,0 +1,47 @@
+#pragma once
+// TwoWire with no bus: devices are host objects attached by address
+// (hostWireAttach). An address with nothing attached NACKs (endTransmission 2)
+// and returns no bytes; a device decides ACK/NACK and what a read returns.
+#include <Arduino.h>
+#include <vector>
+
+struct HostI2cDevice {
+  virtual ~HostI2cDevice() {}
+  // One write transaction; return the endTransmission code (0 = ACK)
+  virtual uint8_t write(const uint8_t* p, size_t n, bool stop) = 0;
+  // Fill up to n bytes of a read; return the count (fewer = short read)
+  virtual size_t  read(uint8_t* p, size_t n) = 0;
+};
+
+class TwoWire {
+public:
+  explicit TwoWire(uint8_t bus) {}
+  bool     begin(int sda = -1, int scl = -1, uint32_t hz = 100000) { hz_ = hz; return true; }
+  bool     end() { return true; }
+  void     setClock(uint32_t hz) { hz_ = hz; }
+  uint32_t getClock() const { return hz_; }
+  void     setTimeOut(uint16_t ms) {}
+
+  void    beginTransmission(uint8_t addr) { addr_ = addr; tx_.clear(); }
+  size_t  write(uint8_t b) { tx_.push_back(b); return 1; }
+  size_t  write(const uint8_t* p, size_t n) { tx_.insert(tx_.end(), p, p + n); return n; }
+  uint8_t endTransmission(bool stop = true);
+  uint8_t requestFrom(uint8_t addr, uint8_t n, uint8_t stop = true);
+  int     available() const { return (int)(rx_.size() - rxPos_); }
+  int     read() { return rxPos_ < rx_.size() ? rx_[rxPos_++] : -1; }
+
+  void attach(uint8_t addr, HostI2cDevice* dev);
+
+private:
+  HostI2cDevice* dev(uint8_t addr) const;
+  struct Slot { uint8_t addr; HostI2cDevice* dev; };
+  std::vector<Slot>    devs_;
+  std::vector<uint8_t> tx_, rx_;
+  size_t   rxPos_ = 0;
+  uint8_t  addr_ = 0;
+  uint32_t hz_ = 100000;
+};
+extern TwoWire Wire;
+extern TwoWire Wire1;
+
+inline void hostWireAttach(TwoWire& w, uint8_t addr, HostI2cDevice* dev) { w.attach(addr, dev); }
@@ -0,0 +1,45 @@
+#pragma once
+// FreeRTOS subset on std::thread/std::mutex. A tick is 1 ms of virtual time
+// (vTaskDelay advances the clock like delay()). Tests drive the modules from
+// one thread; tasks created with xTaskCreatePinnedToCore do run, as threads.
+#include <stdint.h>
+#include <atomic>
+
+typedef void*    TaskHandle_t;
+typedef int      BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void*    SemaphoreHandle_t;
+typedef void*    QueueHandle_t;
+
+#define pdTRUE  1
+#define pdFALSE 0
+#define pdPASS  1
+#define pdFAIL  0
+#define pdMS_TO_TICKS(x) ((TickType_t)(x))
+#define portMAX_DELAY    ((TickType_t)0xffffffffu)
+
+BaseType_t  xTaskCreatePinnedToCore(void (*fn)(void*), const char* name, uint32_t stack, void* arg,
+                                    UBaseType_t prio, TaskHandle_t* out, BaseType_t core);
+void        vTaskDelay(TickType_t ticks);
+void        vTaskDelete(TaskHandle_t t);
+TickType_t  xTaskGetTickCount();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t t);
+uint32_t    xPortGetCoreID();
+int64_t     esp_timer_get_time();
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t        xSemaphoreTake(SemaphoreHandle_t m, TickType_t wait);
+BaseType_t        xSemaphoreGive(SemaphoreHandle_t m);
+
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t itemSize);
+BaseType_t    xQueueSend(QueueHandle_t q, const void* item, TickType_t wait);
+BaseType_t    xQueueReceive(QueueHandle_t q, void* item, TickType_t wait);
+
+// Spinlock: a real one, the ring and counters are shared with the sampler thread
+struct portMUX_TYPE { std::atomic_flag f = ATOMIC_FLAG_INIT; };
+#define portMUX_INITIALIZER_UNLOCKED {}
+inline void hostMuxEnter(portMUX_TYPE* m) { while (m->f.test_and_set(std::memory_order_acquire)) {} }
+inline void hostMuxExit(portMUX_TYPE* m)  { m->f.clear(std::memory_order_release); }
+#define portENTER_CRITICAL(m) hostMuxEnter(m)
+#define portEXIT_CRITICAL(m)  hostMuxExit(m)
@@ -0,0 +1,51 @@
+// The sketch itself, plus the host entry points of sim.h
+#include "../NewAeroSensor.ino"
+#include "sim.h"
+#include <stdio.h>
+
+void simBegin(const char* fsDir, uint32_t startMs) {
+  hostClockSet((uint64_t)startMs * 1000);
+  hostFsRoot(fsDir);
+  storageBegin();
+  logBegin();
+  FLASHFS.format();
+  hostPrefsClear();
+  prefs.begin("aerosens", false);
+  loadSettings();
+  if (!appMutex) appMutex = xSemaphoreCreateMutex();
+}
+
+bool simReplay(const char* path, TraceStatus& st) {
+  if (!traceReplayStart(path)) return false;
+  while (traceReplaying()) {
+    {
+      AppLock lock;
+      Sample s;
+      bool fresh = false;
+      for (size_t n = 0; n < SAMPLE_RING_LEN && traceReplayNext(s); n++) {
+        // live pace: the clock follows the trace (flushes, rotation, retention)
+        if (s.t_ms > millis()) hostClockSet((uint64_t)s.t_ms * 1000);
+        appSample(s);
+        fresh = true;
+      }
+      appHousekeeping(fresh);
+    }
+    logTick(millis());                         // as appTask: outside AppLock
+  }
+  { AppLock lock; appHousekeeping(false); }   // drained → results
+  logTick(millis());
+  traceStatus(st);
+  return st.done;
+}
+
+bool simImport(const char* hostPath, const char* fsPath) {
+  FILE* in = fopen(hostPath, "rb");
+  if (!in) return false;
+  File out = FLASHFS.open(fsPath, FILE_WRITE);
+  uint8_t buf[4096];
+  for (size_t n; out && (n = fread(buf, 1, sizeof(buf), in)) > 0;) out.write(buf, n);
+  fclose(in);
+  const bool ok = out;
+  out.close();
+  return ok;
+}
@@ -0,0 +1,17 @@
+#pragma once
+// Host harness around the sketch (test/sim.cpp includes NewAeroSensor.ino):
+// the app task's per-sample and per-batch steps, driven from one thread on
+// the virtual clock, with the flash FS in a host directory. No sampler,
+// HTTP or export tasks run; a replay feeds the app task straight from the
+// trace reader, so the same trace always gives the same results.
+#include "../Trace.h"
+
+// Fresh "boot": FS at fsDir (emptied), default settings, clock at startMs
+void simBegin(const char* fsDir, uint32_t startMs = 100000);
+
+// Replay a trace (FS path, e.g. "/trace.csv") through the whole app pipeline,
+// advancing the clock with the trace. False if it can't be opened.
+bool simReplay(const char* path, TraceStatus& st);
+
+// Copy a host file into the FS (e.g. a recorded trace)
+bool simImport(const char* hostPath, const char* fsPath);
@@ -0,0 +1,27 @@
+// aero_sim: replay a recorded trace (GET /trace.csv) through the sketch on
+// the host and print what /api/trace would report.
+//   aero_sim <trace.csv> [csv|bin]     (log format; no argument = no log)
+#include "sim.h"
+#include "../Logging.h"
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char** argv) {
+  if (argc < 2) { fprintf(stderr, "usage: %s <trace.csv> [csv|bin]\n", argv[0]); return 2; }
+  simBegin("_fs_sim");
+  if (!simImport(argv[1], "/trace.csv")) { fprintf(stderr, "can't read %s\n", argv[1]); return 1; }
+  if (argc > 2) {
+    logFormat = !strcmp(argv[2], "bin") ? LOG_FMT_BIN : LOG_FMT_CSV;
+    startLogging();
+  }
+  TraceStatus st;
+  if (!simReplay("/trace.csv", st)) { fprintf(stderr, "not a trace: %s\n", argv[1]); return 1; }
+  if (argc > 2) { printf("log: _fs_sim%s\n", currentLogNameC()); stopLogging(); }
+  printf("rows %lu, trace %lu ms\n", (unsigned long)st.rows, (unsigned long)st.traceMs);
+  printf("bins %lu, log rows %lu, nudges %lu, dp_zero end %.4f Pa\n", (unsigned long)st.bins,
+         (unsigned long)st.logRows, (unsigned long)st.nudges, (double)st.dpZeroEnd);
+  printf("gate on %lu / off %lu; onsets %lu, missed %lu, latency mean %lu / max %lu ms\n",
+         (unsigned long)st.gateOn, (unsigned long)st.gateOff, (unsigned long)st.onsets,
+         (unsigned long)st.missed, (unsigned long)st.latMeanMs, (unsigned long)st.latMaxMs);
+  return 0;
+}
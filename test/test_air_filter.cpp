@@ -0,0 +1,147 @@
+// AirFilter: delay and gate behaviour against the figures in AirFilter.h —
+// DC group delay 2τ, gate on at 2 Pa / off below 1 Pa with no chatter,
+// independent of the sample rate.
+#include "check.h"
+#include "../AirFilter.h"
+#include "../Config.h"
+
+// Continuous critically damped step response 1 − e^(−x)(1 + x), x = t/τ:
+// time for a step of height A to reach level L (bisection)
+static double crossMs(double A, double L, double tauMs) {
+  double lo = 0, hi = 50;
+  for (int i = 0; i < 100; i++) {
+    const double x = (lo + hi) / 2;
+    (A * (1 - exp(-x) * (1 + x)) < L ? lo : hi) = x;
+  }
+  return hi * tauMs;
+}
+
+// Gate-on delay (ms) of a step 0 → A sampled every dtMs; -1 if it never opens
+static double gateDelayMs(float A, uint32_t tauMs, double dtMs, double maxMs = 5000) {
+  AirFilter f;
+  f.setTauMs(tauMs);
+  f.step(0, dtMs * 1e-3f);
+  f.gate(0, AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+  for (double t = dtMs; t <= maxMs; t += dtMs)
+    if (f.gate(f.step(A, dtMs * 1e-3f), AIR_GATE_ON_PA, AIR_GATE_OFF_PA)) return t;
+  return -1;
+}
+
+// Steady-state lag of a ramp = group delay. Discrete sections lag
+// dt·e^(−dt/τ)/(1 − e^(−dt/τ)) ≈ τ − dt/2 each, so 2τ within one sample.
+static void groupDelay() {
+  for (uint32_t tau : { 20u, 50u, 200u }) {
+    for (double dt : { 1.0, 10.0 }) {
+      AirFilter f;
+      f.setTauMs(tau);
+      const double k = 0.1;                 // Pa per ms
+      double y = 0, t = 0;
+      for (; t < 30.0 * tau; t += dt) y = f.step((float)(k * t), dt * 1e-3f);
+      t -= dt;
+      CHECK_NEAR((t - y / k), 2.0 * tau, dt);
+    }
+  }
+}
+
+// Gate-on delay: the analytic crossing of AIR_GATE_ON_PA, within one
+// sample; a step of ≥ 3.4 Pa opens within 2τ (1 − 3e^−2 = 59 % at 2τ)
+static void stepDelay() {
+  for (uint32_t tau : { 20u, 50u, 200u }) {
+    for (double dt : { 1.0, 10.0 }) {
+      for (float A : { 2.5f, 3.4f, 5.0f, 20.0f, 100.0f }) {
+        const double got  = gateDelayMs(A, tau, dt);
+        const double want = crossMs(A, AIR_GATE_ON_PA, tau);
+        CHECK(got > 0);
+        CHECK_NEAR(got, want, dt + 0.02 * want);
+        if (A >= 3.4f) CHECK(got <= 2.0 * tau + dt);
+        else           CHECK(got > 2.0 * tau);
+      }
+    }
+  }
+  // same step, 100 vs 1000 S/s: the delay doesn't follow the rate
+  CHECK_NEAR(gateDelayMs(5, 50, 10), gateDelayMs(5, 50, 1), 10);
+  // below the threshold it never opens
+  CHECK(gateDelayMs(1.9f, 50, 10) < 0);
+}
+
+// Gusts: a single-sample spike is rejected, a gust long enough to lift the
+// filtered ΔP past 2 Pa opens the gate
+static bool gustOpens(float A, double durMs, uint32_t tau, double dt) {
+  AirFilter f;
+  f.setTauMs(tau);
+  bool open = false;
+  for (double t = 0; t < 10.0 * tau + durMs + 100; t += dt) {
+    const float x = (t >= dt && t < dt + durMs) ? A : 0.0f;
+    open |= f.gate(f.step(x, dt * 1e-3f), AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+  }
+  return open;
+}
+
+static void gusts() {
+  CHECK(!gustOpens(10, 10, 50, 10));     // one 10 Pa sample at 100 S/s
+  CHECK(!gustOpens(50, 1, 50, 1));       // one 50 Pa sample at 1 kS/s
+  CHECK(!gustOpens(5, 20, 50, 10));
+  CHECK(gustOpens(10, 100, 50, 10));
+  CHECK(gustOpens(5, 100, 50, 1));
+  CHECK(gustOpens(10, 10, 0, 10));       // τ = 0: unfiltered
+}
+
+// Hysteresis: between 1 and 2 Pa the gate keeps its state; a slow 0.5 ↔
+// 2.5 Pa swing with ±0.3 Pa noise toggles once each way per cycle
+static void hysteresis() {
+  uint32_t seed = 1;
+  auto noise = [&seed](float amp) {
+    seed = seed * 1664525u + 1013904223u;
+    return amp * ((seed >> 8) / 8388608.0f - 1.0f);
+  };
+  for (bool startOpen : { false, true }) {
+    AirFilter f;
+    f.setTauMs(50);
+    f.step(startOpen ? 5.0f : 0.0f, 0.01f);
+    bool g = f.gate(startOpen ? 5.0f : 0.0f, AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+    CHECK(g == startOpen);
+    int flips = 0;
+    for (int i = 0; i < 3000; i++) {
+      const bool n = f.gate(f.step(1.5f + noise(0.45f), 0.01f), AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+      if (i > 100) flips += n != g;       // after the filter has settled on 1.5
+      g = n;
+    }
+    CHECK(flips == 0);
+    CHECK(g == startOpen);
+  }
+
+  AirFilter f;
+  f.setTauMs(50);
+  bool g = false;
+  int on = 0, off = 0;
+  const int cycles = 10;
+  for (int i = 0; i < cycles * 400; i++) {          // 4 s period at 100 S/s
+    const float x = 1.5f - cosf(i * 2 * (float)M_PI / 400) + noise(0.3f);
+    const bool n = f.gate(f.step(x, 0.01f), AIR_GATE_ON_PA, AIR_GATE_OFF_PA);
+    on += n && !g; off += !n && g;
+    g = n;
+  }
+  CHECK(on == cycles && off == cycles);
+  // negative ΔP (reversed ports) gates on |ΔP|
+  CHECK(gateDelayMs(-5, 50, 10) == gateDelayMs(5, 50, 10));
+}
+
+static void edges() {
+  AirFilter f;
+  f.setTauMs(0);
+  CHECK(f.step(3, 0.01f) == 3 && f.step(-7, 0.01f) == -7);
+  f.setTauMs(50);
+  f.reset();
+  CHECK(f.step(4, 0.01f) == 4);          // first sample initializes
+  CHECK(f.step(0, 2.0f) == 0);           // a gap > 1 s restarts from the input
+  CHECK(f.step(10, 0) == 10);            // no time step: restart as well
+}
+
+int main() {
+  groupDelay();
+  stepDelay();
+  gusts();
+  hysteresis();
+  edges();
+  return checkDone("air_filter");
+}
@@ -0,0 +1,116 @@
+// LiveStream over a loopback TCP connection: frames stay whole and contiguous
+// when the send buffer only takes part of one, a reader that stops is dropped
+// after LIVE_STALL_MS, a closed peer on a failed send, and an idle stream
+// gets keepalives.
+#include "check.h"
+#include "../Config.h"
+#include "../LiveStream.h"
+#include <WebServer.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+static WebServer web;
+static uint32_t  now = 100000, pushed = 0;
+
+static std::shared_ptr<HostSocket> attach() {
+  HostReply r = web.request(HTTP_GET, "/api/stream");
+  CHECK(r.code == 0 && r.sock);
+  return r.sock;
+}
+
+// One sample every 10 ms, a tick each time (frames every liveFrameMs)
+static void run(uint32_t ms, bool push = true) {
+  for (uint32_t t = 0; t < ms; t += 10) {
+    now += 10;
+    if (push) {
+      Sample s{};
+      s.t_ms = pushed++ * 10;
+      s.dp_Pa = 1.5f;
+      liveStreamPush(s);
+    }
+    liveStreamTick(now);
+  }
+}
+
+// Sample times of all "data:" frames in out, in order; false if any frame
+// is malformed. Keepalives are counted.
+static bool parse(const std::string& out, std::vector<uint32_t>& t, int& keepAlives) {
+  size_t p = out.find("\r\n\r\n");
+  if (p == std::string::npos) return false;
+  p += 4;
+  for (size_t e; (e = out.find("\n\n", p)) != std::string::npos; p = e + 2) {
+    const std::string f = out.substr(p, e - p);
+    if (f == "retry: 2000") continue;
+    if (f == ": ka") { keepAlives++; continue; }
+    if (f.compare(0, 12, "data: {\"t0\":") != 0 || f.back() != '}') return false;
+    char* q;
+    const unsigned long long t0 = strtoull(f.c_str() + 12, &q, 10);
+    if (strncmp(q, ",\"d\":[", 6)) return false;
+    q += 6;
+    while (*q == '[') {
+      t.push_back((uint32_t)(t0 + strtoul(q + 1, &q, 10)));
+      q = strchr(q, ']');
+      if (!q) return false;
+      q++;
+      if (*q == ',') q++;
+    }
+    if (*q != ']') return false;
+  }
+  return p == out.size();
+}
+
+static void partialWrites() {
+  auto sock = attach();
+  sock->setSendBuf(4096);
+  CHECK(liveStreamClients() == 1);
+  bool split = false;
+  for (int i = 0; i < 10; i++) {
+    run(3000);                               // reader away: the buffer fills
+    const std::string& out = sock->drain();
+    split |= out.compare(out.size() - 2, 2, "\n\n") != 0;
+    for (int k = 0; k < 20; k++) { run(200); sock->drain(); }   // and catches up
+  }
+  for (int i = 0; i < 5; i++) { run(200, false); sock->drain(); }
+  CHECK(split);                              // a frame was cut by a full buffer
+  CHECK(liveStreamClients() == 1 && liveStreamSkipped() == 0);
+
+  std::vector<uint32_t> t;
+  int ka = 0;
+  CHECK(parse(sock->out, t, ka));
+  CHECK(t.size() == pushed);
+  for (uint32_t i = 0; i < t.size(); i++) if (t[i] != i * 10) { CHECK(t[i] == i * 10); break; }
+  sock->hangUp();
+  run(1000);                                 // the first send after it only draws the RST
+  CHECK(liveStreamClients() == 0);           // closed peer: dropped on a failed send
+}
+
+static void stalledReader() {
+  auto sock = attach();
+  sock->setSendBuf(4096);
+  run(LIVE_STALL_MS / 2);                    // never drained: the buffer fills
+  CHECK(liveStreamClients() == 1);
+  run(LIVE_STALL_MS);
+  CHECK(liveStreamClients() == 0);
+  CHECK(liveStreamSkipped() > 0);            // lapped the ring while stuck
+  CHECK(sock->drain().find("retry: 2000") != std::string::npos);
+}
+
+static void keepAlive() {
+  auto sock = attach();
+  run(16000, false);
+  std::vector<uint32_t> t;
+  int ka = 0;
+  CHECK(parse(sock->drain(), t, ka));
+  CHECK(t.empty() && ka >= 1);
+  CHECK(liveStreamClients() == 1);
+}
+
+int main() {
+  web.on("/api/stream", HTTP_GET, []{ liveStreamAttach(web); });
+  partialWrites();
+  stalledReader();
+  keepAlive();
+  return checkDone("test_live_stream");
+}
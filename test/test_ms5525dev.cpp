@@ -0,0 +1,237 @@
+// Ms5525Dev state machine on a scripted I2cPort (start, collect, NACK and
+// short-read paths, paced mode), then the same device model on the mock
+// Wire behind sensorPoll(): a paced (quiet-rate) run must not count a
+// single conversion failure, a NACKed start must count exactly one.
+#include "check.h"
+#include "../MS5525Dev.h"
+#include "../SensorMS5525.h"
+#include "../Metrics.h"
+#include "../Config.h"
+#include <Wire.h>
+#include <vector>
+
+static const uint16_t PROM[8] = { 0x0123, 36000, 39000, 23000, 23500, 33000, 28000, 0x0007 };
+
+// MS5525DSO command set with scripted faults. Timing is the driver's job:
+// the model only records when the ADC was read.
+struct Ms5525Model {
+  struct Op { uint8_t cmd; bool stop; };
+  std::vector<Op> log;              // every write, in order
+  uint32_t d1 = 0x500000, d2 = 0x80E800;
+  uint8_t  nackCmd = 0, nackLeft = 0;   // NACK the next nackLeft writes of cmd (0xFF = any)
+  uint8_t  shortLeft = 0;               // next reads return one byte short
+  uint8_t  pending = 0;                 // conversion command in flight (0 = none)
+  uint8_t  rd[3] = {};
+  uint8_t  rdN = 0;
+
+  uint8_t cmd(uint8_t c, bool stop) {
+    log.push_back({ c, stop });
+    if (nackLeft && (nackCmd == 0xFF || nackCmd == c)) { nackLeft--; return 2; }
+    if (c >= 0xA0 && c <= 0xAE) {                       // PROM word
+      const uint16_t w = PROM[(c - 0xA0) / 2];
+      rd[0] = w >> 8; rd[1] = w & 0xFF; rdN = 2;
+    } else if (c == 0x00) {                             // ADC read: result of the last conversion
+      const uint32_t v = pending == 0 ? 0 : (pending & 0xF0) == 0x40 ? d1 : d2;
+      rd[0] = v >> 16; rd[1] = v >> 8; rd[2] = v; rdN = 3;
+      pending = 0;
+    } else if ((c & 0xF0) == 0x40 || (c & 0xF0) == 0x50) {
+      pending = c;
+    } else if (c == 0x1E) {
+      pending = 0;
+    }
+    return 0;
+  }
+  uint8_t read(uint8_t* p, uint8_t n) {
+    uint8_t k = min(n, rdN);
+    if (shortLeft && k) { shortLeft--; k--; }
+    memcpy(p, rd, k);
+    return k;
+  }
+  size_t writesOf(uint8_t c) const { size_t n = 0; for (const Op& o : log) n += o.cmd == c; return n; }
+};
+
+struct ScriptedPort : I2cPort {
+  Ms5525Model m;
+  uint8_t addr = 0;
+  uint8_t write(uint8_t a, uint8_t c, bool stop) override { addr = a; return m.cmd(c, stop); }
+  uint8_t read(uint8_t a, uint8_t* p, uint8_t n) override { return m.read(p, n); }
+};
+
+// the same model on the mock Wire bus
+struct WireMs5525 : HostI2cDevice {
+  Ms5525Model m;
+  uint8_t write(const uint8_t* p, size_t n, bool stop) override { return n ? m.cmd(p[0], stop) : 0; }
+  size_t  read(uint8_t* p, size_t n) override { return m.read(p, (uint8_t)n); }
+};
+
+constexpr uint8_t D1_OSR0 = 0x40, D2_OSR0 = 0x50, D1_OSR4 = 0x48, D2_OSR4 = 0x58;
+
+static void prom() {
+  ScriptedPort port;
+  Ms5525Dev dev;
+  dev.attach(&port, 0x76);
+  CHECK(dev.reset());
+  CHECK(dev.loadProm(100.0f));
+  CHECK(!memcmp(dev.prom(), PROM, sizeof(PROM)));
+  CHECK(port.addr == 0x76);
+  CHECK(port.m.log.size() == 9 && port.m.log[0].cmd == 0x1E);
+  for (int i = 0; i < 8; i++) CHECK(port.m.log[1 + i].cmd == 0xA0 + 2 * i && !port.m.log[1 + i].stop);
+  Ms5525Coef k; ms5525Prepare(PROM, 100.0f, k);
+  CHECK(dev.coef().sens0 == k.sens0 && dev.coef().off0 == k.off0 && dev.coef().tref == k.tref);
+
+  port.m.shortLeft = 1;                 // a short PROM read fails the load
+  CHECK(!dev.loadProm(100.0f));
+}
+
+// D2 first, then D1s back to back, D2 again every tempEvery D1s; no bus
+// traffic while a conversion runs
+static void startCollect() {
+  ScriptedPort port;
+  Ms5525Dev dev;
+  dev.attach(&port, 0x76);
+  const uint32_t conv = ms5525ConvUs(4);
+  uint32_t t = 0;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Wait);
+  CHECK(port.m.log.back().cmd == D2_OSR4 && dev.converting() == Ms5525Dev::Conv::D2);
+  const size_t ops = port.m.log.size();
+  CHECK(dev.poll(t + conv - 1) == Ms5525Dev::Step::Wait);
+  CHECK(port.m.log.size() == ops);
+  CHECK(dev.waitUs(t + conv - 1) == 1);
+
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Temp);
+  CHECK(dev.d2() == port.m.d2);
+  CHECK(port.m.log[ops].cmd == 0x00 && !port.m.log[ops].stop);
+  CHECK(port.m.log.back().cmd == D1_OSR4);            // restarted at once
+  for (int i = 1; i <= 25; i++) {
+    port.m.d1 = 0x500000 + i;
+    t += conv;
+    const Ms5525Dev::Step st = dev.poll(t);
+    if (st == Ms5525Dev::Step::Temp) { i--; continue; }
+    CHECK(st == Ms5525Dev::Step::Pressure);
+    CHECK(dev.d1() == port.m.d1);
+  }
+  // 25 D1s at tempEvery 10: D2 at the start and after the 10th and 20th
+  CHECK(port.m.writesOf(D2_OSR4) == 3);
+  CHECK(port.m.writesOf(D1_OSR4) == 26);             // the 26th is running
+
+  dev.setOsr(0, 0);                                    // next start uses the new OSR
+  t += conv;
+  dev.poll(t);
+  CHECK(port.m.log.back().cmd == D1_OSR0 || port.m.log.back().cmd == D2_OSR0);
+}
+
+static void nackPaths() {
+  ScriptedPort port;
+  Ms5525Dev dev;
+  dev.attach(&port, 0x76);
+  dev.setOsr(0, 0);
+  const uint32_t conv = ms5525ConvUs(0);
+  uint32_t t = 0;
+
+  // start NACKed while idle: StartFail, stays idle, the next poll retries
+  port.m.nackCmd = D2_OSR0; port.m.nackLeft = 1;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::StartFail);
+  CHECK(dev.converting() == Ms5525Dev::Conv::Idle);
+  CHECK(dev.waitUs(t) == 1000);
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Wait);
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Temp);
+
+  // restart NACKed right after a collect: the sample is still good, the
+  // next poll reports the failed start, the one after recovers
+  port.m.nackCmd = D1_OSR0; port.m.nackLeft = 2;
+  t += conv;
+  // (the D1 started after the Temp above went through before the NACK was armed)
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Pressure);
+  CHECK(dev.converting() == Ms5525Dev::Conv::Idle);
+  CHECK(dev.poll(t) == Ms5525Dev::Step::StartFail);
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Wait);
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Pressure);
+
+  // ADC command NACKed: conversion lost → Fail, a new one is started at once
+  const uint32_t d1 = dev.d1();
+  port.m.d1 = d1 + 7;
+  port.m.nackCmd = 0x00; port.m.nackLeft = 1;
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Fail);
+  CHECK(dev.d1() == d1);
+  CHECK(dev.converting() != Ms5525Dev::Conv::Idle);
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Pressure && dev.d1() == d1 + 7);
+
+  // short ADC read: Fail as well
+  port.m.shortLeft = 1;
+  t += conv;
+  CHECK(dev.poll(t) == Ms5525Dev::Step::Fail);
+  CHECK(dev.d1() == d1 + 7);
+}
+
+// Paced: idle after every D1 by design; polling an idle device starts the
+// next conversion and is not a failure
+static void paced() {
+  ScriptedPort port;
+  Ms5525Dev dev;
+  dev.attach(&port, 0x76);
+  dev.setOsr(0, 0);
+  dev.setPaced(true);
+  const uint32_t conv = ms5525ConvUs(0);
+  uint32_t t = 0, pressure = 0, fails = 0;
+  for (int i = 0; i < 500; i++) {
+    const Ms5525Dev::Step st = dev.poll(t);
+    if (st == Ms5525Dev::Step::Pressure) {
+      pressure++;
+      CHECK(dev.converting() == Ms5525Dev::Conv::Idle);
+      t += 20000;                        // quiet slot
+    } else {
+      t += conv;
+    }
+    fails += st == Ms5525Dev::Step::Fail || st == Ms5525Dev::Step::StartFail;
+  }
+  CHECK(fails == 0);
+  CHECK(pressure > 100);
+}
+
+// sensorPoll() on the mock Wire: CNT_CONV_FAIL counts real failures only
+static void sensorModule() {
+  static WireMs5525 chip;
+  hostWireAttach(Wire, MS5525_ADDR, &chip);
+  sensorSetOsr(0, 0);
+  sensorBegin();
+  uint16_t C[8]; sensorProm(C);
+  CHECK(!memcmp(C, PROM, sizeof(C)));
+
+  auto run = [](int polls, bool quiet) {
+    uint32_t samples = 0;
+    float P, T;
+    for (int i = 0; i < polls; i++) {
+      if (sensorPoll(P, T)) { samples++; if (quiet) delay(20); }
+      const uint32_t w = sensorWaitUs();
+      delayMicroseconds(w ? w : 1);
+    }
+    return samples;
+  };
+
+  const uint32_t fail0 = metricGet(CNT_CONV_FAIL);
+  CHECK(run(200, false) > 50);
+  CHECK(metricGet(CNT_CONV_FAIL) == fail0);
+
+  sensorSetPaced(true);                  // adaptive rate, quiet cadence
+  CHECK(run(400, true) > 50);
+  CHECK(metricGet(CNT_CONV_FAIL) == fail0);
+
+  chip.m.nackCmd = 0xFF; chip.m.nackLeft = 1;   // one NACK, on whatever comes next
+  run(50, true);
+  CHECK(metricGet(CNT_CONV_FAIL) == fail0 + 1);
+  sensorSetPaced(false);
+}
+
+int main() {
+  prom();
+  startCollect();
+  nackPaths();
+  paced();
+  sensorModule();
+  return checkDone("ms5525dev");
+}
@@ -0,0 +1,106 @@
+// Trace replay regression: a synthetic step trace through the whole app
+// pipeline (conversion, zero nudge, filter/gate, 1 Hz bins, CSV log) with
+// the results worked out by hand.
+//
+//   0–20 s  ΔP = 0    (raw P = 0, trace zero = 0.5 Pa: |ΔP| < 1 → quiet)
+//   20–25 s P = 100 Pa (one pressure count at MS5525_P_SCALE)
+//   25–40 s ΔP = 0    again; 100 S/s throughout
+#include "sim.h"
+#include "check.h"
+#include "../Logging.h"
+#include "../MS5525Comp.h"
+#include "../Config.h"
+#include <FS.h>
+#include <SPIFFS.h>
+#include <string>
+#include <vector>
+
+static const uint16_t PROM[8] = { 0, 36000, 39000, 23000, 23500, 33000, 28000, 0 };
+
+// D1 for a raw pressure count at D2 = C5·2^8 (dT = 0: OFF = C2·2^16, SENS = C1·2^15)
+static uint32_t d1For(int32_t praw) {
+  const int64_t off = (int64_t)PROM[2] << 16;
+  const int64_t num = (((int64_t)praw << 15) + off) * 64;
+  return (uint32_t)((num + PROM[1] - 1) / PROM[1]);
+}
+
+static void writeTrace(const char* path) {
+  File f = SPIFFS.open(path, FILE_WRITE);
+  f.printf("#aerotrace v1 prom=%u,%u,%u,%u,%u,%u,%u,%u zero=0.5 invert=0\n",
+           PROM[0], PROM[1], PROM[2], PROM[3], PROM[4], PROM[5], PROM[6], PROM[7]);
+  f.print("t_ms,D1,D2,envP_Pa,envT_C,envRH_pct,envHum\n");
+  const uint32_t d2 = (uint32_t)PROM[5] << 8;
+  for (uint32_t t = 0; t < 40000; t += 10) {
+    const int32_t praw = (t >= 20000 && t < 25000) ? 1 : 0;
+    f.printf("%u,%u,%u,101325.0,20.00,50.0,1\n", t, d1For(praw), d2);
+  }
+  f.close();
+}
+
+static std::vector<std::string> split(const std::string& s) {
+  std::vector<std::string> v;
+  size_t a = 0;
+  for (size_t b; (b = s.find(',', a)) != std::string::npos; a = b + 1) v.push_back(s.substr(a, b - a));
+  v.push_back(s.substr(a));
+  return v;
+}
+
+int main() {
+  simBegin("_fs_replay");
+
+  // the generator hits the intended counts
+  Ms5525Coef k; ms5525Prepare(PROM, MS5525_P_SCALE, k);
+  float P, T;
+  ms5525Convert(k, d1For(0), (uint32_t)PROM[5] << 8, P, T);
+  CHECK_NEAR(P, 0, 0); CHECK_NEAR(T, 20, 0);
+  ms5525Convert(k, d1For(1), (uint32_t)PROM[5] << 8, P, T);
+  CHECK_NEAR(P, 100, 0);
+
+  writeTrace("/step.csv");
+  logFormat = LOG_FMT_CSV;
+  logEveryMs = 1000;
+  startLogging();
+  CHECK(loggingOn);
+  const String logName = currentLogName();
+
+  TraceStatus st;
+  CHECK(simReplay("/step.csv", st));
+  stopLogging();
+
+  CHECK(st.rows == 4000);
+  CHECK(st.traceMs == 39990);
+  CHECK(st.bins == 39);                 // 40 s from a whole second; the last bin stays open
+  CHECK(st.logRows == 39);
+  // quiet from 0 s: nudge at 10 s; flow 20–25 s; quiet again from 25 s: nudge at 35 s
+  CHECK(st.nudges == 2);
+  CHECK_NEAR(st.dpZeroEnd, 0.5 * 0.98 * 0.98, 1e-5);
+  CHECK(st.gateOn == 1 && st.gateOff == 1);
+  CHECK(st.onsets == 1 && st.missed == 0);
+  CHECK(st.latMaxMs <= 2u * AIR_FILTER_MS);
+  CHECK(dp_zero == 0.0f);               // live zero restored after the replay
+
+  // the log: header + one row per closed second, ΔP median per bin
+  File f = SPIFFS.open(logName, FILE_READ);
+  CHECK(f);
+  std::vector<std::string> lines;
+  while (f.available()) {
+    String l = f.readStringUntil('\n');
+    l.trim();
+    if (l.length()) lines.push_back(l.str());
+  }
+  CHECK(lines.size() == 40);
+  if (lines.size() == 40) {
+    const std::vector<std::string> cols = split(lines[0]);
+    size_t dpCol = cols.size();
+    for (size_t i = 0; i < cols.size(); i++) if (cols[i] == "dp_Pa") dpCol = i;
+    CHECK(dpCol < cols.size());
+    for (size_t r = 1; r < lines.size() && dpCol < cols.size(); r++) {
+      const float dp = strtof(split(lines[r])[dpCol].c_str(), nullptr);
+      const int sec = (int)r - 1;                  // trace second of this row
+      const double zero = sec < 10 ? 0.5 : sec < 35 ? 0.49 : 0.4802;
+      const double want = (sec >= 20 && sec < 25 ? 100.0 : 0.0) - zero;
+      CHECK_NEAR(dp, want, 0.01);
+    }
+  }
+  return checkDone("replay");
+}
@@ -0,0 +1,123 @@
+// SpscRing under two threads: order, no loss while the producer respects the
+// capacity, exact overflow and high-water counts when it doesn't.
+#include "check.h"
+#include "../SampleRing.h"
+#include <atomic>
+#include <thread>
+
+// Record about the size of a Sample; every word derives from seq so a torn
+// copy (consumer reading a slot the producer is rewriting) shows up
+struct Rec {
+  uint32_t seq;
+  uint32_t w[23];
+  void fill(uint32_t s) { seq = s; for (uint32_t i = 0; i < 23; i++) w[i] = s * 2654435761u + i; }
+  bool intact() const {
+    for (uint32_t i = 0; i < 23; i++) if (w[i] != seq * 2654435761u + i) return false;
+    return true;
+  }
+};
+
+constexpr size_t   N = 256;          // SAMPLE_RING_LEN
+constexpr uint32_t M = 300000;       // records per run
+
+static void singleThread() {
+  SpscRing<Rec, N> r;
+  Rec x;
+  CHECK(!r.pop(x));
+  for (uint32_t i = 0; i < N; i++) { x.fill(i); CHECK(r.push(x)); }
+  for (uint32_t i = 0; i < 5; i++)  { x.fill(1000 + i); CHECK(!r.push(x)); }
+  CHECK(r.size() == N && r.highWater() == N && r.overflows() == 5 && r.pushed() == N);
+  for (uint32_t i = 0; i < N; i++) { CHECK(r.pop(x)); CHECK(x.seq == i && x.intact()); }
+  CHECK(!r.pop(x) && r.size() == 0);
+  // wrap the 32-bit-indexed slots many times at depth ≤ 3
+  for (uint32_t i = 0; i < 10 * N; i++) {
+    x.fill(i); CHECK(r.push(x));
+    if (i % 3 == 2) for (int k = 0; k < 3; k++) r.pop(x);
+  }
+  CHECK(r.highWater() == N && r.overflows() == 5);
+}
+
+// Producer waits for room: nothing may be lost, order and contents kept
+static void noLoss() {
+  static SpscRing<Rec, N> r;
+  std::atomic<uint32_t> bad{0};
+  std::thread cons([&] {
+    Rec x;
+    for (uint32_t want = 0; want < M;) {
+      if (!r.pop(x)) { std::this_thread::yield(); continue; }
+      if (x.seq != want || !x.intact()) bad++;
+      want = x.seq + 1;
+    }
+  });
+  Rec x;
+  uint32_t refused = 0;
+  for (uint32_t i = 0; i < M; i++) {
+    while (r.size() >= r.capacity()) std::this_thread::yield();
+    x.fill(i);
+    if (!r.push(x)) refused++;
+  }
+  cons.join();
+  CHECK(bad == 0);
+  CHECK(refused == 0 && r.overflows() == 0);
+  CHECK(r.pushed() == M);
+  CHECK(r.highWater() >= 1 && r.highWater() <= N);
+  CHECK(r.size() == 0);
+}
+
+// Producer pushes blindly at a consumer that is slower: every refused push
+// is one counted overflow, everything accepted arrives in order
+static void overflow() {
+  static SpscRing<Rec, N> r;
+  std::atomic<bool> done{false};
+  std::atomic<uint32_t> bad{0}, got{0};
+  std::thread cons([&] {
+    Rec x;
+    uint32_t last = 0;
+    bool first = true;
+    for (;;) {
+      const bool end = done;           // read first: then an empty ring is final
+      if (!r.pop(x)) { if (end) break; std::this_thread::yield(); continue; }
+      if ((!first && x.seq <= last) || !x.intact()) bad++;
+      last = x.seq; first = false;
+      got++;
+      for (volatile int k = 0; k < 50; k++) {}     // slow consumer
+    }
+  });
+  Rec x;
+  uint32_t refused = 0;
+  for (uint32_t i = 0; i < M; i++) { x.fill(i); if (!r.push(x)) refused++; }
+  done = true;
+  cons.join();
+  CHECK(bad == 0);
+  CHECK(refused > 0);
+  CHECK(r.overflows() == refused);
+  CHECK(got + refused == M);
+  CHECK(r.pushed() == got);
+  CHECK(r.highWater() == N);         // a refusal means the ring was full
+}
+
+// Consumer held off: exactly N fit, the rest overflow
+static void stalledConsumer() {
+  static SpscRing<Rec, N> r;
+  std::atomic<bool> go{false};
+  std::atomic<uint32_t> got{0}, bad{0};
+  std::thread cons([&] {
+    while (!go) std::this_thread::yield();
+    Rec x;
+    for (uint32_t want = 0; r.pop(x); want++) { if (x.seq != want || !x.intact()) bad++; got++; }
+  });
+  Rec x;
+  for (uint32_t i = 0; i < N + 100; i++) { x.fill(i); r.push(x); }
+  go = true;
+  cons.join();
+  CHECK(r.overflows() == 100 && r.highWater() == N && r.pushed() == N);
+  CHECK(got == N && bad == 0);
+}
+
+int main() {
+  singleThread();
+  noLoss();
+  overflow();
+  stalledConsumer();
+  return checkDone("ring");
+}
@@ -0,0 +1,104 @@
+// StreamStats against exact statistics of the same samples: min/max/mean/
+// stddev, and p05/median/p95 on both paths — exact nearest-rank while a bin
+// holds ≤ AGG_EXACT_N samples, P² beyond.
+//
+// Tolerances (fixed seeds, margin over the worst of a 200-run sweep):
+//   mean, stddev       1e-5 relative (Welford in double)
+//   exact path         quantiles bit-identical to the sorted reference
+//   P², n ≤ 200        rank of the estimate within ±0.10 of p
+//   P², n ≥ 1000       rank within ±0.025; Gaussian value within 6 % of p95−p05
+//   constant input     every statistic exact
+#include "check.h"
+#include "../Config.h"
+#include "../StreamStats.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+typedef StreamStats<AGG_EXACT_N> Stats;
+static const float P[3] = { 0.05f, 0.50f, 0.95f };
+
+static float q(const Stats& s, int k) { return k == 0 ? s.p05() : k == 1 ? s.median() : s.p95(); }
+
+struct Ref {
+  std::vector<float> v;            // sorted
+  double mean = 0, sd = 0;
+  explicit Ref(std::vector<float> x) : v(std::move(x)) {
+    std::sort(v.begin(), v.end());
+    for (float f : v) mean += f;
+    mean /= v.size();
+    for (float f : v) sd += (f - mean) * (f - mean);
+    sd = v.size() > 1 ? sqrt(sd / (v.size() - 1)) : 0;
+  }
+  float  at(float p) const { return v[(size_t)lroundf(p * (v.size() - 1))]; }
+  double rank(float x) const { return (double)(std::upper_bound(v.begin(), v.end(), x) - v.begin()) / v.size(); }
+};
+
+static Stats run(const std::vector<float>& x) {
+  Stats s; s.reset();
+  for (float f : x) s.add(f);
+  return s;
+}
+
+static void checkMoments(const Stats& s, const Ref& r) {
+  CHECK(s.n == r.v.size());
+  CHECK(s.min == r.v.front() && s.max == r.v.back());
+  CHECK_NEAR(s.mean, r.mean, 1e-5 * (fabs(r.mean) + 1));
+  CHECK_NEAR(s.stddev(), r.sd, 1e-5 * (r.sd + 1e-3));
+}
+
+enum Dist { GAUSS, UNIFORM, RAMP, BIMODAL };
+
+static std::vector<float> draw(std::mt19937& g, Dist d, size_t n) {
+  std::normal_distribution<float> nd(50, 3);
+  std::uniform_real_distribution<float> ud(-10, 10);
+  std::vector<float> x(n);
+  for (size_t i = 0; i < n; i++)
+    x[i] = d == GAUSS ? nd(g) : d == UNIFORM ? ud(g) : d == RAMP ? i * 0.01f : nd(g) + (i & 1) * 20;
+  return x;
+}
+
+int main() {
+  std::mt19937 g(12345);
+
+  // empty / single / constant
+  { Stats s; s.reset(); CHECK(isnan(s.median()) && isnan(s.p95()) && s.stddev() == 0); }
+  { Stats s = run({ 3.5f }); CHECK(s.p05() == 3.5f && s.median() == 3.5f && s.p95() == 3.5f && s.stddev() == 0); }
+  {
+    Stats s = run(std::vector<float>(1000, -1.25f));
+    CHECK(s.p05() == -1.25f && s.median() == -1.25f && s.p95() == -1.25f);
+    CHECK(s.mean == -1.25 && s.stddev() == 0);
+  }
+
+  // exact path, up to and including N (with duplicates: 0.5 Pa quantization)
+  for (size_t n : { 2, 5, 17, 63, (int)AGG_EXACT_N }) {
+    for (int rep = 0; rep < 20; rep++) {
+      std::vector<float> x = draw(g, GAUSS, n);
+      if (rep & 1) for (float& f : x) f = roundf(f * 2) / 2;
+      const Stats s = run(x);
+      const Ref r(x);
+      checkMoments(s, r);
+      for (int k = 0; k < 3; k++) CHECK(q(s, k) == r.at(P[k]));
+    }
+  }
+
+  // P² path
+  for (Dist d : { GAUSS, UNIFORM, RAMP, BIMODAL }) {
+    for (size_t n : { (size_t)AGG_EXACT_N + 1, (size_t)100, (size_t)200, (size_t)1000, (size_t)10000 }) {
+      for (int rep = 0; rep < 20; rep++) {
+        const std::vector<float> x = draw(g, d, n);
+        const Stats s = run(x);
+        const Ref r(x);
+        checkMoments(s, r);
+        const double spread = r.at(0.95f) - r.at(0.05f);
+        for (int k = 0; k < 3; k++) {
+          const float e = q(s, k);
+          CHECK(e >= r.v.front() && e <= r.v.back());
+          CHECK_NEAR(r.rank(e), P[k], n >= 1000 ? 0.025 : 0.10);
+          if (d == GAUSS && n >= 1000) CHECK_NEAR(e, r.at(P[k]), 0.06 * spread);
+        }
+      }
+    }
+  }
+  return checkDone("stream_stats");
+}
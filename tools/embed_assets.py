@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Compress web/ into WebAssets.h (gzip blobs in flash + strong ETags).
+
+Run after editing anything under web/:   python3 tools/embed_assets.py
+The output is deterministic (gzip mtime 0), so unchanged sources give an
+unchanged header and unchanged ETags.
+"""
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB = os.path.join(ROOT, "web")
+OUT = os.path.join(ROOT, "WebAssets.h")
+
+# (source, URL path, content type, symbol)
+ASSETS = [
+    ("app.js",     "/app.js", "application/javascript", "APP_JS"),
+    ("index.html", "/",       "text/html",              "INDEX_HTML"),
+]
+
+
+def etag(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def main():
+    tags = {}
+    out = [
+        "#pragma once",
+        "// Generated by tools/embed_assets.py from web/ — do not edit.",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "  const char*    path;",
+        "  const char*    type;",
+        "  const uint8_t* gz;       // gzip body (PROGMEM)",
+        "  size_t         len;",
+        "  const char*    etag;     // strong, quoted",
+        "};",
+        "",
+    ]
+    table = []
+    for src, path, ctype, sym in ASSETS:
+        with open(os.path.join(WEB, src), "rb") as f:
+            data = f.read()
+        # pages reference the versioned script so it can be cached forever
+        for other, tag in tags.items():
+            data = data.replace(('src="%s"' % other).encode(), ('src="%s?v=%s"' % (other, tag)).encode())
+        tag = etag(data)
+        tags[path] = tag
+        gz = gzip.compress(data, 9, mtime=0)
+        out.append("// %s: %d B → %d B gzip" % (src, len(data), len(gz)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % sym)
+        for i in range(0, len(gz), 20):
+            out.append("  " + ",".join("0x%02x" % b for b in gz[i:i + 20]) + ",")
+        out.append("};")
+        out.append("")
+        table.append('  { "%s", "%s", %s_GZ, sizeof(%s_GZ), "\\"%s\\"" },' % (path, ctype, sym, sym, tag))
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    out.extend(table)
+    out.append("};")
+    out.append("")
+    with open(OUT, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,333 @@
+const fmt = v=> (Math.round(v*100)/100).toFixed(2);
+let logging=false, curFile="";
+const live = {t:[], dp:[], va:[], tc:[]};
+
+// Charts: minimal canvas line plotter (no external libraries — the AP has
+// no internet). Left/right y axes, time x axis, per-pixel min/max decimation.
+class LineChart {
+  constructor(cv, t, series){
+    this.cv = cv; this.t = t; this.s = series; this.pending = false;
+    if (window.ResizeObserver) new ResizeObserver(()=>this.update()).observe(cv.parentElement);
+  }
+  update(){
+    if (this.pending) return;
+    this.pending = true;
+    requestAnimationFrame(()=>{ this.pending = false; this.draw(); });
+  }
+  range(axis){
+    let lo = Infinity, hi = -Infinity;
+    for (const s of this.s) if ((s.axis||'l') === axis)
+      for (const v of s.data) if (v != null && isFinite(v)) { if (v < lo) lo = v; if (v > hi) hi = v; }
+    if (lo > hi) return null;
+    const pad = (hi - lo) * 0.05 || Math.abs(hi) * 0.05 || 1;
+    return [lo - pad, hi + pad];
+  }
+  draw(){
+    const cv = this.cv, dpr = window.devicePixelRatio || 1, box = cv.parentElement;
+    const W = box.clientWidth, H = box.clientHeight;
+    if (cv.width !== W*dpr || cv.height !== H*dpr) {
+      cv.width = W*dpr; cv.height = H*dpr; cv.style.width = W+'px'; cv.style.height = H+'px';
+    }
+    const g = cv.getContext('2d');
+    g.setTransform(dpr, 0, 0, dpr, 0, 0);
+    g.clearRect(0, 0, W, H);
+    g.font = '12px system-ui,sans-serif'; g.lineWidth = 1;
+    const L = 48, R = this.s.some(s=>s.axis==='r') ? 48 : 12, T = 22, B = 20;
+    const pw = W - L - R, ph = H - T - B, t = this.t, n = t.length;
+
+    // legend
+    let lx = L;
+    for (const s of this.s) {
+      g.fillStyle = s.color; g.fillRect(lx, 6, 12, 3);
+      g.fillStyle = '#e5e7eb'; g.fillText(s.label, lx + 16, 12); lx += g.measureText(s.label).width + 34;
+    }
+    if (n < 2 || pw < 10 || ph < 10) return;
+
+    const t0 = +t[0], t1 = +t[n-1], ts = (t1 - t0) || 1;
+    const X = ms=> L + (ms - t0) / ts * pw;
+    const ax = {l: this.range('l'), r: this.range('r')};
+
+    // grid + axis labels
+    g.strokeStyle = '#1f2937'; g.fillStyle = '#94a3b8';
+    for (let k = 0; k <= 4; k++) {
+      const y = T + ph * k / 4;
+      g.beginPath(); g.moveTo(L, y); g.lineTo(L + pw, y); g.stroke();
+      if (ax.l) { g.textAlign = 'right'; g.fillText((ax.l[1] - (ax.l[1]-ax.l[0])*k/4).toFixed(2), L - 4, y + 4); }
+      if (ax.r && R > 12) { g.textAlign = 'left'; g.fillText((ax.r[1] - (ax.r[1]-ax.r[0])*k/4).toFixed(2), L + pw + 4, y + 4); }
+    }
+    g.textAlign = 'center';
+    for (let k = 0; k <= 4; k++) {
+      const ms = t0 + ts * k / 4;
+      g.fillText(new Date(ms).toLocaleTimeString(), Math.min(Math.max(X(ms), L + 30), L + pw - 30), H - 4);
+    }
+    g.textAlign = 'left';
+
+    // series: at most one min/max pair per pixel column
+    for (const s of this.s) {
+      const r = ax[s.axis||'l']; if (!r) continue;
+      const Y = v=> T + (r[1] - v) / (r[1] - r[0]) * ph;
+      g.strokeStyle = s.color; g.lineWidth = 1.5; g.beginPath();
+      let col = -1, mn = 0, mx = 0, pen = false;
+      const flush = ()=>{ if (col < 0) return;
+        if (!pen) { g.moveTo(col, Y(mn)); pen = true; } else g.lineTo(col, Y(mn));
+        if (mx !== mn) g.lineTo(col, Y(mx)); };
+      for (let i = 0; i < n; i++) {
+        const v = s.data[i];
+        if (v == null || !isFinite(v)) { flush(); col = -1; pen = false; continue; }
+        const c = Math.round(X(+t[i]));
+        if (c !== col) { flush(); col = c; mn = mx = v; }
+        else { if (v < mn) mn = v; if (v > mx) mx = v; }
+      }
+      flush(); g.stroke();
+    }
+  }
+}
+const ch1 = new LineChart(document.getElementById('c1'), live.t, [
+  {label:'ΔP (Pa)', data:live.dp, color:'#22c55e'},
+  {label:'V (m/s)', data:live.va, color:'#3b82f6', axis:'r'}]);
+const ch2 = new LineChart(document.getElementById('c2'), live.t, [
+  {label:'Temp (°C)', data:live.tc, color:'#f59e0b'}]);
+
+function setState(s){ document.getElementById('state').textContent = s; }
+
+async function syncTime(){
+  try{
+    const epoch_ms = Date.now();                 // browser wall time
+    const tz_min   = new Date().getTimezoneOffset(); // minutes west of UTC (e.g. Türkiye = -180)
+    await fetch('/api/time',{method:'POST', headers:{'Content-Type':'application/json'},
+      body: JSON.stringify({epoch_ms, tz_min})});
+  }catch(e){ console.warn('time sync failed', e); }
+}
+
+for (const id of ['osrp','osrt']) {
+  const sel = document.getElementById(id);
+  [256,512,1024,2048,4096].forEach(v=>{ const o=document.createElement('option'); o.value=v; o.textContent=v; sel.appendChild(o); });
+}
+
+async function loadSettings(){
+  const r = await fetch('/api/settings'); const s = await r.json();
+  document.getElementById('invert').checked = !!s.invert;
+  document.getElementById('logms').value   = s.logms;
+  document.getElementById('logfmt').value  = s.logfmt;
+  document.getElementById('flushs').value  = s.flushms/1000;
+  document.getElementById('keeppct').value = s.keeppct;
+  document.getElementById('adaptive').checked = !!s.adaptive;
+  document.getElementById('filtms').value = s.filtms;
+  document.getElementById('streamms').value= s.streamms;
+  document.getElementById('tevery').value  = s.tevery;
+  document.getElementById('osrp').value    = s.osr_p;
+  document.getElementById('osrt').value    = s.osr_t;
+  document.getElementById('envhz').value   = s.envhz;
+  // extra ΔP sensors: one invert box each
+  const box = document.getElementById('auxinv'); box.innerHTML = '';
+  (s.aux||[]).forEach((a,i)=>{
+    const l = document.createElement('label');
+    l.innerHTML = `<input id="dp${i+1}_inv" type="checkbox"> Invert ΔP${i+1}${a.online ? '' : ' (offline)'}`;
+    box.appendChild(l);
+    document.getElementById(`dp${i+1}_inv`).checked = !!a.invert;
+  });
+}
+
+async function refreshFiles(){
+  const r = await fetch('/api/files'); const j = await r.json();
+  const sel = document.getElementById('files'); sel.innerHTML='';
+  (j.files||[]).forEach(f=>{
+    const name = (typeof f === 'string') ? f : f.name;
+    const size = (typeof f === 'object' && f.size!=null) ? ` (${f.size} B)` : '';
+    // logs with an index: time span + rows
+    const span = (typeof f === 'object' && f.t0!=null)
+      ? ` ${new Date(f.t0).toLocaleString()} – ${new Date(f.t1).toLocaleTimeString()}, ${f.rows} rows` : '';
+    const o=document.createElement('option'); o.value=name; o.textContent=name+size+span; sel.appendChild(o);
+  });
+}
+
+function showStatus(dp, va, tc, dpx){
+  document.getElementById('btnLog').textContent = logging? 'Stop logging' : 'Start logging';
+  document.getElementById('btnDl').disabled = !curFile;
+  const aux = (dpx||[]).map((v,i)=>`, ΔP${i+1}=${v==null ? '—' : fmt(v)}`).join('');
+  setState(`ΔP=${fmt(dp)} Pa${aux}, V=${fmt(va)} m/s, T=${fmt(tc)} °C${logging? ' — logging → '+curFile:''}`);
+}
+
+function showEnv(rho, ap, at, ah, hasH){
+  const env = document.getElementById('env');
+  const hpa = (ap/100).toFixed(1);
+  const rh  = hasH ? `, RH=${ah.toFixed(0)}%` : '';
+  env.textContent = `ρ=${rho.toFixed(3)} kg/m³, P=${hpa} hPa, T=${at.toFixed(1)} °C${rh}`;
+}
+
+function addPoint(t, dp, va, tc, dp_s, tc_s){
+  const sm = document.getElementById('smooth').checked;
+  live.t.push(t); live.dp.push(sm? dp_s : dp); live.va.push(va); live.tc.push(sm? tc_s : tc);
+  if (live.t.length>LIVE_MAX){ live.t.shift(); live.dp.shift(); live.va.shift(); live.tc.shift(); }
+}
+
+// Push stream (SSE): every sample, batched; falls back to polling on error
+const LIVE_MAX = 3000;
+let es = null, polling = false;
+const sm10 = {n:0, dp:0, tc:0};   // 10-pt running mean, per sample
+function startStream(){
+  if (!window.EventSource) { startPolling(); return; }
+  es = new EventSource('/api/stream');
+  es.onmessage = ev=>{
+    const j = JSON.parse(ev.data);
+    logging = !!j.lg; curFile = j.f || "";
+    let last = null;
+    for (const d of j.d) {
+      sm10.n = Math.min(10, sm10.n+1);
+      sm10.dp += (d[1]-sm10.dp)/sm10.n; sm10.tc += (d[3]-sm10.tc)/sm10.n;
+      addPoint(new Date(j.t0 + d[0]), d[1], d[2], d[3], sm10.dp, sm10.tc);
+      last = d;
+    }
+    if (last) showStatus(last[1], last[2], last[3], j.x);
+    showEnv(j.e[0], j.e[1], j.e[2], j.e[3], !!j.e[4]);
+    ch1.update(); ch2.update();
+  };
+  es.onerror = ()=>{
+    es.close(); es = null;
+    startPolling();
+    setTimeout(()=>{ polling = false; startStream(); }, 15000);   // try push again later
+  };
+}
+
+// Backfill the charts from the on-device 1 s history (page load / reconnect)
+async function backfill(){
+  try{
+    const r = await fetch('/api/history?res=1&since=-600000'); if(!r.ok) return;
+    const j = await r.json();
+    for (const d of j.d) addPoint(new Date((j.t0 + d[0])*1000), d[2], d[5], d[8], d[2], d[8]);
+    ch1.update(); ch2.update();
+  }catch(e){ console.warn('history backfill failed', e); }
+}
+
+function startPolling(){ if (!polling) { polling = true; poll(); } }
+
+async function poll(){
+  if (!polling) return;
+  try{
+    const r = await fetch('/api/sample'); if(!r.ok) throw 0;
+    const j = await r.json();
+
+    logging = !!j.logging; curFile = j.curFile || "";
+    showStatus(j.dp, j.va, j.tc, j.dpx);
+
+    // env
+    if (typeof j.rho === 'number' && typeof j.ap === 'number' && typeof j.at === 'number')
+      showEnv(j.rho, j.ap, j.at, j.ah || 0, !!j.hasH);
+
+    // Use real timestamp `ts` (epoch ms from device)
+    addPoint(new Date(j.ts || j.t), j.dp, j.va, j.tc, j.dp_s, j.tc_s); // fallback to t if ts absent
+    ch1.update(); ch2.update();
+  }catch(e){ setState('disconnected…'); }
+  setTimeout(poll, 200);
+}
+
+// SAVE
+document.getElementById('btnSave').onclick = async ()=>{
+  try{
+    const invert = document.getElementById('invert').checked;
+    const logms  = +document.getElementById('logms').value;
+    const logfmt = document.getElementById('logfmt').value;
+    const flushms= 1000 * +document.getElementById('flushs').value;
+    const keeppct= +document.getElementById('keeppct').value;
+    const adaptive = document.getElementById('adaptive').checked;
+    const filtms = +document.getElementById('filtms').value;
+    const streamms = +document.getElementById('streamms').value;
+    const tevery = +document.getElementById('tevery').value;
+    const osr_p  = +document.getElementById('osrp').value;
+    const osr_t  = +document.getElementById('osrt').value;
+    const envhz  = +document.getElementById('envhz').value;
+    const body   = { invert, logms, logfmt, flushms, keeppct, adaptive, filtms, streamms, tevery, osr_p, osr_t, envhz };
+    document.querySelectorAll('#auxinv input').forEach(el=>{ body[el.id] = el.checked; });
+    const r = await fetch('/api/settings',{
+      method:'POST', headers:{'Content-Type':'application/json'},
+      body: JSON.stringify(body)
+    });
+    if(r.status===409){ alert('OSR profile running — save again when it has finished'); return; }
+    if(!r.ok) throw new Error('save failed');
+    const mode = logms >= 1000 ? '1 Hz median rows' : (logms ? `raw, every ${logms} ms` : 'raw, every sample');
+    alert(`Saved ✓\nLog period: ${logms} ms (${mode})\nInvert ΔP: ${invert ? 'on' : 'off'}`);
+  }catch(e){ console.error(e); alert('Save failed'); }
+};
+
+document.getElementById('btnProf').onclick = async ()=>{
+  if (!confirm('Sweep OSR256…4096 (~10 s)?\n\nKeep both ports in still air.')) return;
+  try{
+    const r = await fetch('/api/osr/profile',{method:'POST'});
+    if (!r.ok) throw new Error('busy');
+    let j;
+    do { await new Promise(ok=>setTimeout(ok, 1000)); j = await (await fetch('/api/osr')).json(); } while (j.profiling);
+    alert('OSR profile\n' + j.profile.map(p=>`OSR${p.osr}: ${p.sps.toFixed(1)} S/s, ${p.noise_Pa.toFixed(3)} Pa RMS`).join('\n'));
+  }catch(e){ console.error(e); alert('Profile failed'); }
+};
+
+document.getElementById('btnZero').onclick = async ()=>{
+  if (!confirm('Zero differential pressure sensor?\n\nMake sure both ports are open to still air.')) return;
+  const btn = document.getElementById('btnZero');
+  btn.disabled = true;
+  setState('zeroing…');
+  try {
+    const r = await fetch('/api/zero',{method:'POST'});
+    if (!r.ok) throw new Error('zero busy');
+    let j;
+    do {
+      await new Promise(ok=>setTimeout(ok, 250));
+      j = await (await fetch('/api/zero')).json();
+      setState(`zeroing… ${j.progress}%`);
+    } while (j.running);
+    if (!j.ok) throw new Error('zero failed');
+    setState('zeroed');
+    alert(`Zero completed ✓\nSamples: ${j.samples}\nNew dp_zero: ${j.dp_zero.toFixed(4)} Pa`);
+  } catch(e) {
+    console.error(e);
+    setState('zero failed');
+    alert('Zero failed ❌');
+  } finally {
+    btn.disabled = false;
+  }
+};
+
+document.getElementById('btnLog').onclick  = async ()=>{
+  try{
+    const cmd = logging? 'stop' : 'start';
+    const r = await fetch('/api/log?cmd='+cmd,{method:'POST'});
+    const j = await r.json();
+    if (j.error) { alert(`Logging error: ${j.error}${j.fs_total? `\nFS: ${j.fs_used}/${j.fs_total}`:''}`); }
+    logging = !!j.logging; 
+    curFile = j.curFile || "";
+    document.getElementById('btnLog').textContent = logging? 'Stop logging' : 'Start logging';
+    document.getElementById('btnDl').disabled = !curFile;
+    setTimeout(refreshFiles, 200);
+  }catch(e){ console.error(e); alert('Logging command failed'); }
+};
+
+document.getElementById('btnDl').onclick   = ()=>{ if (curFile) location.href='/download?file='+encodeURIComponent(curFile); };
+
+document.getElementById('btnDelOne').onclick= async ()=>{
+  const f=document.getElementById('files').value;
+  if(!f){ alert('Select a file first'); return; }
+  if(!confirm('Delete '+f+' ?')) return;
+  try{
+    const r = await fetch('/api/delete?file='+encodeURIComponent(f),{method:'POST'});
+    const j = await r.json();
+    if (!j.ok) alert(j.error ? 'Delete failed: ' + j.error : 'Delete failed');
+    refreshFiles();
+  }catch(e){ console.error(e); alert('Delete failed'); }
+};
+
+document.getElementById('btnFormat').onclick= async ()=>{
+  if(!confirm('FORMAT the filesystem and reboot? All files will be erased.')) return;
+  try{
+    await fetch('/api/format',{method:'POST'});
+    alert('Formatted; device will reboot…');
+    setTimeout(()=>location.reload(), 4000);
+  }catch(e){ console.error(e); alert('Format failed'); }
+};
+
+document.getElementById('btnGet').onclick  = ()=>{
+  const f=document.getElementById('files').value;
+  const from=document.getElementById('range').value;
+  if(f) location.href='/download?file='+encodeURIComponent(f)+(from? '&from='+from : '');
+};
+
+// Kickoff
+(async()=>{ await syncTime(); await loadSettings(); await refreshFiles(); await backfill(); startStream(); })();